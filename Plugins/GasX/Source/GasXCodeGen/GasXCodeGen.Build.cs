@@ -0,0 +1,20 @@
+using UnrealBuildTool;
+
+public class GasXCodeGen : ModuleRules
+{
+    public GasXCodeGen(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        // WHY: Core only, so the standalone GasXGen program can link this without the engine
+        PublicDependencyModuleNames.AddRange(new[]
+        {
+            "Core"
+        });
+
+        PrivateDependencyModuleNames.AddRange(new[]
+        {
+            "Json"
+        });
+    }
+}
@@ -0,0 +1,954 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXAttributeSetEmitter.h"
+#include "Logging/LogMacros.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXAttributeSetEmitter, Log, All);
+
+namespace GasXAttributeSetEmitter
+{
+	bool HasFlags(const FGasXAttributeSetSchema &Schema)
+	{
+		return Schema.Attributes.ContainsByPredicate([](const FGasXAttributeDefinition &Attr) { return Attr.IsFlag(); });
+	}
+
+	/** Bit of a flag attribute: flags are numbered in schema order. */
+	int32 GetFlagIndex(const FGasXAttributeSetSchema &Schema, const FGasXAttributeDefinition &Flag)
+	{
+		int32 FlagIndex = 0;
+		for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+		{
+			if (&Attr == &Flag)
+			{
+				return FlagIndex;
+			}
+			FlagIndex += Attr.IsFlag() ? 1 : 0;
+		}
+		return INDEX_NONE;
+	}
+}
+
+bool FGasXAttributeSetEmitter::GenerateFiles(
+	const FGasXAttributeSetSchema &Schema,
+	const FString &OutputHeaderPath,
+	const FString &OutputSourcePath,
+	FString &OutError) const
+{
+	FString ValidationError;
+	if (!ValidateSchema(Schema, ValidationError))
+	{
+		OutError = FString::Printf(TEXT("Schema validation failed: %s"), *ValidationError);
+		return false;
+	}
+
+	if (!EnsureOutputDirectory(FPaths::GetPath(OutputHeaderPath)))
+	{
+		OutError = FString::Printf(TEXT("Failed to create output directory for header: %s"), *OutputHeaderPath);
+		return false;
+	}
+
+	if (!EnsureOutputDirectory(FPaths::GetPath(OutputSourcePath)))
+	{
+		OutError = FString::Printf(TEXT("Failed to create output directory for source: %s"), *OutputSourcePath);
+		return false;
+	}
+
+	FString HeaderContent = GenerateHeaderContent(Schema);
+	FString SourceContent = GenerateSourceContent(Schema);
+
+	// WHY: Merge with existing files to preserve custom code outside guarded regions
+	FString FinalHeaderContent = MergeWithExistingFile(OutputHeaderPath, HeaderContent);
+	FString FinalSourceContent = MergeWithExistingFile(OutputSourcePath, SourceContent);
+
+	if (!WriteFileIfChanged(OutputHeaderPath, FinalHeaderContent))
+	{
+		OutError = FString::Printf(TEXT("Failed to write header file: %s"), *OutputHeaderPath);
+		return false;
+	}
+
+	if (!WriteFileIfChanged(OutputSourcePath, FinalSourceContent))
+	{
+		OutError = FString::Printf(TEXT("Failed to write source file: %s"), *OutputSourcePath);
+		return false;
+	}
+
+	UE_LOG(LogGasXAttributeSetEmitter, Log, TEXT("Successfully generated AttributeSet: %s"), *Schema.AttributeSetClassName);
+	UE_LOG(LogGasXAttributeSetEmitter, Log, TEXT("  Header: %s"), *OutputHeaderPath);
+	UE_LOG(LogGasXAttributeSetEmitter, Log, TEXT("  Source: %s"), *OutputSourcePath);
+	return true;
+}
+
+bool FGasXAttributeSetEmitter::CollectOutOfDateFiles(
+	const FGasXAttributeSetSchema &Schema,
+	const FString &OutputHeaderPath,
+	const FString &OutputSourcePath,
+	TArray<FString> &OutOutOfDateFiles,
+	FString &OutError) const
+{
+	if (!ValidateSchema(Schema, OutError))
+	{
+		return false;
+	}
+
+	const TPair<FString, FString> Outputs[] = {
+		{OutputHeaderPath, GenerateHeaderContent(Schema)},
+		{OutputSourcePath, GenerateSourceContent(Schema)}};
+
+	for (const TPair<FString, FString> &Output : Outputs)
+	{
+		FString ExistingContent;
+		if (!FFileHelper::LoadFileToString(ExistingContent, *Output.Key))
+		{
+			OutOutOfDateFiles.Add(Output.Key);
+			continue;
+		}
+
+		// WHY: Same merge as a real run, so custom code outside guarded regions never counts as a difference
+		const FString MergedContent = ReplaceGuardedRegions(ExistingContent, Output.Value);
+		if (!MergedContent.Equals(ExistingContent, ESearchCase::CaseSensitive))
+		{
+			OutOutOfDateFiles.Add(Output.Key);
+		}
+	}
+
+	return true;
+}
+
+void FGasXAttributeSetEmitter::ResolveOutputPaths(const FGasXAttributeSetSchema &Schema, const FString &PluginDir, FString &OutHeaderPath, FString &OutSourcePath)
+{
+	const FString ModuleDir = PluginDir / TEXT("Source") / Schema.TargetModule;
+	const FString OutputDir = ModuleDir / Schema.TargetDirectory;
+
+	OutHeaderPath = OutputDir / (Schema.AttributeSetClassName + TEXT(".h"));
+	OutSourcePath = FPaths::Combine(ModuleDir, TEXT("Private"), TEXT("Attributes"), Schema.AttributeSetClassName + TEXT(".cpp"));
+}
+
+bool FGasXAttributeSetEmitter::ValidateSchema(const FGasXAttributeSetSchema &Schema, FString &OutError) const
+{
+	if (Schema.AttributeSetClassName.IsEmpty())
+	{
+		OutError = TEXT("AttributeSetClassName cannot be empty");
+		return false;
+	}
+
+	if (!IsValidIdentifier(Schema.AttributeSetClassName))
+	{
+		OutError = FString::Printf(TEXT("AttributeSetClassName '%s' is not a valid C++ identifier"), *Schema.AttributeSetClassName);
+		return false;
+	}
+
+	if (Schema.bIsFragment)
+	{
+		OutError = FString::Printf(TEXT("'%s' is a shared fragment and cannot be generated on its own"), *Schema.AttributeSetClassName);
+		return false;
+	}
+
+	// WHY: The generator only works on flattened schemas; Extends/Include must be resolved by FGasXSchemaGraph first
+	if (!Schema.Extends.IsEmpty() || Schema.Includes.Num() > 0)
+	{
+		OutError = TEXT("Schema has unresolved Extends/Include references; load it through FGasXSchemaGraph");
+		return false;
+	}
+
+	if (Schema.Attributes.Num() == 0)
+	{
+		OutError = TEXT("Schema must contain at least one attribute");
+		return false;
+	}
+
+	TSet<FString> SeenNames;
+	int32 NumFlags = 0;
+	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	{
+		if (Attr.AttributeName.IsEmpty())
+		{
+			OutError = TEXT("Attribute name cannot be empty");
+			return false;
+		}
+
+		FString LowerName = Attr.AttributeName.ToLower();
+		if (SeenNames.Contains(LowerName))
+		{
+			OutError = FString::Printf(TEXT("Duplicate attribute name (case-insensitive): %s"), *Attr.AttributeName);
+			return false;
+		}
+		SeenNames.Add(LowerName);
+
+		if (!IsValidIdentifier(Attr.AttributeName))
+		{
+			OutError = FString::Printf(TEXT("Attribute name '%s' is not a valid C++ identifier"), *Attr.AttributeName);
+			return false;
+		}
+
+		if (IsReservedKeyword(Attr.AttributeName))
+		{
+			OutError = FString::Printf(TEXT("Attribute name '%s' is a reserved C++ keyword"), *Attr.AttributeName);
+			return false;
+		}
+
+		if (Attr.AttributeType != TEXT("float") && Attr.AttributeType != TEXT("int32") && !Attr.IsFlag())
+		{
+			OutError = FString::Printf(TEXT("Attribute type '%s' not supported (use 'float', 'int32' or 'flag')"), *Attr.AttributeType);
+			return false;
+		}
+
+		if (Attr.IsFlag())
+		{
+			// WHY: All flags share one replicated property, so they cannot opt out individually
+			if (!Attr.bReplicates || Attr.IsArray() || Attr.LevelCurve.Num() > 0)
+			{
+				OutError = FString::Printf(TEXT("Flag '%s' must replicate and cannot be an array or declare a LevelCurve"), *Attr.AttributeName);
+				return false;
+			}
+
+			if (++NumFlags > MaxFlags)
+			{
+				OutError = FString::Printf(TEXT("Schema declares more than %d flags"), MaxFlags);
+				return false;
+			}
+		}
+
+		for (int32 KeyIndex = 0; KeyIndex < Attr.LevelCurve.Num(); ++KeyIndex)
+		{
+			const float Level = Attr.LevelCurve[KeyIndex].Level;
+			if (Level < 0.0f || (KeyIndex > 0 && Level <= Attr.LevelCurve[KeyIndex - 1].Level))
+			{
+				OutError = FString::Printf(TEXT("LevelCurve of '%s' must have non-negative, strictly increasing levels"), *Attr.AttributeName);
+				return false;
+			}
+		}
+
+		if (Attr.IsArray())
+		{
+			if (Attr.ArraySize > MaxArrayElements)
+			{
+				OutError = FString::Printf(TEXT("Attribute array '%s' has %d elements (max %d)"), *Attr.AttributeName, Attr.ArraySize, MaxArrayElements);
+				return false;
+			}
+
+			if (Attr.AttributeType != TEXT("float"))
+			{
+				OutError = FString::Printf(TEXT("Attribute array '%s' must be of type 'float'"), *Attr.AttributeName);
+				return false;
+			}
+
+			// NOTE: Array elements are not FGameplayAttributes, so level curves and init effects cannot address them
+			if (Attr.LevelCurve.Num() > 0)
+			{
+				OutError = FString::Printf(TEXT("Attribute array '%s' cannot declare a LevelCurve"), *Attr.AttributeName);
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+FString FGasXAttributeSetEmitter::GenerateHeaderContent(const FGasXAttributeSetSchema &Schema) const
+{
+	FString Header = TEXT("// Copyright Epic Games, Inc.\n");
+	Header += TEXT("// AUTO-GENERATED by GasXAttributeSetGenerator - DO NOT EDIT MANUALLY\n\n");
+	Header += TEXT("#pragma once\n\n");
+	Header += TEXT("#include \"CoreMinimal.h\"\n");
+	Header += TEXT("#include \"AttributeSet.h\"\n");
+	Header += TEXT("#include \"AbilitySystemComponent.h\"\n");
+	if (Schema.bGenerateInitGameplayEffect)
+	{
+		Header += TEXT("#include \"GameplayEffect.h\"\n");
+	}
+	if (Schema.Attributes.ContainsByPredicate([](const FGasXAttributeDefinition &Attr) { return Attr.IsArray(); }))
+	{
+		Header += TEXT("#include \"GasXAttributeArray.h\"\n");
+	}
+	if (GasXAttributeSetEmitter::HasFlags(Schema))
+	{
+		Header += TEXT("#include \"GasXFlagAttributeSet.h\"\n");
+	}
+	if (Schema.bJournal)
+	{
+		Header += TEXT("#include \"GasXAttributeJournal.h\"\n");
+	}
+	Header += TEXT("#include \"GasXResettableAttributeSet.h\"\n");
+	Header += FString::Printf(TEXT("#include \"%s.generated.h\"\n\n"), *Schema.AttributeSetClassName);
+
+	Header += TEXT("/**\n");
+	Header += FString::Printf(TEXT(" * Generated AttributeSet: %s\n"), *Schema.AttributeSetClassName);
+	if (!Schema.Description.IsEmpty())
+	{
+		Header += FString::Printf(TEXT(" * %s\n"), *Schema.Description);
+	}
+	Header += TEXT(" */\n");
+	Header += TEXT("UCLASS()\n");
+	Header += FString::Printf(TEXT("class %s_API U%s : public %s, public IGasXResettableAttributeSet\n"), *Schema.TargetModule.ToUpper(), *Schema.AttributeSetClassName,
+							  GasXAttributeSetEmitter::HasFlags(Schema) ? TEXT("UGasXFlagAttributeSet") : TEXT("UAttributeSet"));
+	Header += TEXT("{\n");
+	Header += TEXT("\tGENERATED_BODY()\n\n");
+	Header += TEXT("public:\n");
+	Header += FString::Printf(TEXT("\tU%s();\n\n"), *Schema.AttributeSetClassName);
+
+	// Generate attribute properties
+	Header += TEXT("\t//GEN-BEGIN: Attribute Properties\n");
+	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	{
+		if (!Attr.IsFlag())
+		{
+			Header += GenerateAttributeProperty(Attr);
+		}
+	}
+	Header += TEXT("\t//GEN-END: Attribute Properties\n\n");
+
+	// Generate accessors
+	Header += TEXT("\t//GEN-BEGIN: Attribute Accessors\n");
+	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	{
+		if (!Attr.IsFlag())
+		{
+			Header += GenerateAccessors(Attr, Schema.AttributeSetClassName, Schema.bJournal);
+		}
+	}
+	Header += TEXT("\t//GEN-END: Attribute Accessors\n\n");
+
+	// Generate OnRep declarations
+	Header += TEXT("\t//GEN-BEGIN: OnRep Functions\n");
+	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	{
+		// NOTE: Array elements and flags notify through their container's change delegate instead of an OnRep
+		if (Attr.bReplicates && Attr.bRepNotify && Attr.IsGameplayAttribute())
+		{
+			Header += GenerateOnRepDeclaration(Attr);
+		}
+	}
+	Header += TEXT("\t//GEN-END: OnRep Functions\n\n");
+
+	Header += GenerateFlagDeclarations(Schema);
+
+	Header += TEXT("\t//GEN-BEGIN: Journal Hooks\n");
+	if (Schema.bJournal)
+	{
+		Header += TEXT("\tvirtual bool PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data) override;\n");
+		Header += TEXT("\tvirtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;\n");
+	}
+	Header += TEXT("\t//GEN-END: Journal Hooks\n\n");
+
+	Header += TEXT("\t//GEN-BEGIN: Reset To Defaults\n");
+	Header += TEXT("\tvirtual void ResetToDefaults() override;\n");
+	Header += TEXT("\t//GEN-END: Reset To Defaults\n\n");
+
+	Header += TEXT("\tvirtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;\n");
+	Header += TEXT("};\n\n");
+
+	Header += GenerateInitEffectDeclaration(Schema);
+
+	return Header;
+}
+
+FString FGasXAttributeSetEmitter::GenerateSourceContent(const FGasXAttributeSetSchema &Schema) const
+{
+	FString Source = TEXT("// Copyright Epic Games, Inc.\n");
+	Source += TEXT("// AUTO-GENERATED by GasXAttributeSetGenerator - DO NOT EDIT MANUALLY\n\n");
+	Source += FString::Printf(TEXT("#include \"Attributes/%s.h\"\n"), *Schema.AttributeSetClassName);
+	Source += TEXT("#include \"Net/UnrealNetwork.h\"\n");
+	if (Schema.bGenerateInitGameplayEffect)
+	{
+		Source += TEXT("#include \"GasXInitAttributeRegistry.h\"\n");
+		Source += TEXT("#include \"NativeGameplayTags.h\"\n");
+	}
+	if (Schema.bJournal)
+	{
+		Source += TEXT("#include \"GameplayEffectExtension.h\"\n");
+	}
+	Source += TEXT("\n");
+
+	// Constructor
+	Source += FString::Printf(TEXT("U%s::U%s()\n"), *Schema.AttributeSetClassName, *Schema.AttributeSetClassName);
+	Source += TEXT("{\n");
+	Source += TEXT("\t//GEN-BEGIN: Constructor Initialization\n");
+	Source += GenerateDefaultAssignments(Schema, /*bReset*/ false);
+	Source += TEXT("\t//GEN-END: Constructor Initialization\n");
+	Source += TEXT("}\n\n");
+
+	// OnRep implementations
+	Source += TEXT("//GEN-BEGIN: OnRep Implementations\n");
+	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	{
+		if (Attr.bReplicates && Attr.bRepNotify && Attr.IsGameplayAttribute())
+		{
+			Source += GenerateOnRepImplementation(Attr, Schema.AttributeSetClassName);
+		}
+	}
+	Source += TEXT("//GEN-END: OnRep Implementations\n\n");
+
+	// Replication setup
+	Source += GenerateReplicationSetup(Schema);
+
+	Source += TEXT("\n");
+	Source += GenerateInitEffectImplementation(Schema);
+	Source += TEXT("\n");
+	Source += GenerateInitAttributeRegistration(Schema);
+	Source += TEXT("\n");
+	Source += GenerateFlagImplementation(Schema);
+	Source += TEXT("\n");
+	Source += GenerateResetToDefaults(Schema);
+	Source += TEXT("\n");
+	Source += GenerateJournalHooks(Schema);
+
+	return Source;
+}
+
+FString FGasXAttributeSetEmitter::GenerateDefaultAssignments(const FGasXAttributeSetSchema &Schema, bool bReset) const
+{
+	FString Assignments;
+	uint64 DefaultFlagBits = 0;
+	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	{
+		if (Attr.IsArray())
+		{
+			Assignments += bReset
+							   ? FString::Printf(TEXT("\t%s.ResetToDefaults();\n"), *Attr.AttributeName)
+							   : FString::Printf(TEXT("\t%s.Init(TEXT(\"%s\"), %d, %.2ff);\n"), *Attr.AttributeName, *Attr.AttributeName, Attr.ArraySize, Attr.DefaultValue);
+			continue;
+		}
+		if (Attr.IsFlag())
+		{
+			DefaultFlagBits |= Attr.DefaultValue != 0.0 ? 1ull << GasXAttributeSetEmitter::GetFlagIndex(Schema, Attr) : 0;
+			continue;
+		}
+		if (bReset)
+		{
+			// WHY: Resets go through the owning ASC so its aggregators and change delegates see the new base values
+			Assignments += FString::Printf(TEXT("\tResetAttribute(this, Get%sAttribute(), %.2ff);\n"), *Attr.AttributeName, Attr.DefaultValue);
+			continue;
+		}
+		Assignments += FString::Printf(TEXT("\t%s.SetBaseValue(%.2ff);\n"), *Attr.AttributeName, Attr.DefaultValue);
+		Assignments += FString::Printf(TEXT("\t%s.SetCurrentValue(%.2ff);\n"), *Attr.AttributeName, Attr.DefaultValue);
+	}
+	if (GasXAttributeSetEmitter::HasFlags(Schema))
+	{
+		Assignments += bReset ? FString(TEXT("\tResetFlagBits();\n")) : FString::Printf(TEXT("\tInitFlagBits(0x%016llxull);\n"), DefaultFlagBits);
+	}
+	return Assignments;
+}
+
+FString FGasXAttributeSetEmitter::GenerateResetToDefaults(const FGasXAttributeSetSchema &Schema) const
+{
+	FString Impl = TEXT("//GEN-BEGIN: Reset To Defaults\n");
+	Impl += FString::Printf(TEXT("void U%s::ResetToDefaults()\n"), *Schema.AttributeSetClassName);
+	Impl += TEXT("{\n");
+	Impl += GenerateDefaultAssignments(Schema, /*bReset*/ true);
+	Impl += TEXT("}\n");
+	Impl += TEXT("//GEN-END: Reset To Defaults\n");
+	return Impl;
+}
+
+FString FGasXAttributeSetEmitter::GenerateJournalHooks(const FGasXAttributeSetSchema &Schema) const
+{
+	FString Impl = TEXT("//GEN-BEGIN: Journal Hooks\n");
+	if (Schema.bJournal)
+	{
+		Impl += FString::Printf(TEXT("bool U%s::PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data)\n"), *Schema.AttributeSetClassName);
+		Impl += TEXT("{\n");
+		Impl += TEXT("\tFGasXAttributeJournal::BeginEffectExecute(Data);\n");
+		Impl += TEXT("\treturn Super::PreGameplayEffectExecute(Data);\n");
+		Impl += TEXT("}\n\n");
+		Impl += FString::Printf(TEXT("void U%s::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)\n"), *Schema.AttributeSetClassName);
+		Impl += TEXT("{\n");
+		Impl += TEXT("\tSuper::PostGameplayEffectExecute(Data);\n");
+		Impl += TEXT("\tFGasXAttributeJournal::EndEffectExecute(Data);\n");
+		Impl += TEXT("}\n");
+	}
+	Impl += TEXT("//GEN-END: Journal Hooks\n");
+	return Impl;
+}
+
+FString FGasXAttributeSetEmitter::GenerateAttributeProperty(const FGasXAttributeDefinition &Attribute) const
+{
+	FString Property;
+	if (!Attribute.Description.IsEmpty())
+	{
+		Property += FString::Printf(TEXT("\t/** %s */\n"), *Attribute.Description);
+	}
+
+	if (Attribute.IsArray())
+	{
+		// WHY: Fast array containers are not Blueprint types; generated accessors expose the elements instead
+		Property += Attribute.bReplicates ? TEXT("\tUPROPERTY(Replicated)\n") : TEXT("\tUPROPERTY()\n");
+		Property += FString::Printf(TEXT("\tFGasXAttributeArray %s;\n\n"), *Attribute.AttributeName);
+		return Property;
+	}
+
+	Property += TEXT("\tUPROPERTY(BlueprintReadOnly, Category=\"Attributes\"");
+	if (Attribute.bReplicates && Attribute.bRepNotify)
+	{
+		Property += FString::Printf(TEXT(", ReplicatedUsing=OnRep_%s"), *Attribute.AttributeName);
+	}
+	Property += TEXT(")\n");
+	Property += FString::Printf(TEXT("\tFGameplayAttributeData %s;\n\n"), *Attribute.AttributeName);
+
+	return Property;
+}
+
+FString FGasXAttributeSetEmitter::GenerateOnRepDeclaration(const FGasXAttributeDefinition &Attribute) const
+{
+	FString Decl = TEXT("\tUFUNCTION()\n");
+	Decl += FString::Printf(TEXT("\tvirtual void OnRep_%s(const FGameplayAttributeData& OldValue);\n\n"), *Attribute.AttributeName);
+	return Decl;
+}
+
+FString FGasXAttributeSetEmitter::GenerateAccessors(const FGasXAttributeDefinition &Attribute, const FString &ClassName, bool bJournal) const
+{
+	FString Accessors;
+	if (Attribute.IsArray())
+	{
+		// WHY: Same shape as the GAMEPLAYATTRIBUTE_VALUE_* accessors, plus an element index
+		const TCHAR *Name = *Attribute.AttributeName;
+		Accessors += FString::Printf(TEXT("\tint32 GetNum%s() const { return %s.Num(); }\n"), Name, Name);
+		Accessors += FString::Printf(TEXT("\tfloat Get%s(int32 Index) const { return %s.GetCurrentValue(Index); }\n"), Name, Name);
+		Accessors += FString::Printf(TEXT("\tfloat Get%sBase(int32 Index) const { return %s.GetBaseValue(Index); }\n"), Name, Name);
+		Accessors += FString::Printf(TEXT("\tvoid Set%s(int32 Index, float NewVal) { %s.SetBaseValue(Index, NewVal); }\n"), Name, Name);
+		Accessors += FString::Printf(TEXT("\tvoid Set%sCurrent(int32 Index, float NewVal) { %s.SetCurrentValue(Index, NewVal); }\n\n"), Name, Name);
+		return Accessors;
+	}
+
+	Accessors += FString::Printf(TEXT("\tGAMEPLAYATTRIBUTE_PROPERTY_GETTER(U%s, %s)\n"), *ClassName, *Attribute.AttributeName);
+	Accessors += FString::Printf(TEXT("\tGAMEPLAYATTRIBUTE_VALUE_GETTER(%s)\n"), *Attribute.AttributeName);
+	Accessors += FString::Printf(bJournal ? TEXT("\tGASX_JOURNALED_VALUE_SETTER(%s)\n") : TEXT("\tGAMEPLAYATTRIBUTE_VALUE_SETTER(%s)\n"), *Attribute.AttributeName);
+	Accessors += FString::Printf(TEXT("\tGAMEPLAYATTRIBUTE_VALUE_INITTER(%s)\n\n"), *Attribute.AttributeName);
+	return Accessors;
+}
+
+FString FGasXAttributeSetEmitter::GenerateOnRepImplementation(const FGasXAttributeDefinition &Attribute, const FString &ClassName) const
+{
+	FString Impl;
+	Impl += FString::Printf(TEXT("void U%s::OnRep_%s(const FGameplayAttributeData& OldValue)\n"), *ClassName, *Attribute.AttributeName);
+	Impl += TEXT("{\n");
+	Impl += FString::Printf(TEXT("\tGAMEPLAYATTRIBUTE_REPNOTIFY(U%s, %s, OldValue);\n"), *ClassName, *Attribute.AttributeName);
+	Impl += TEXT("}\n\n");
+	return Impl;
+}
+
+FString FGasXAttributeSetEmitter::GenerateReplicationSetup(const FGasXAttributeSetSchema &Schema) const
+{
+	FString Repl;
+	Repl += FString::Printf(TEXT("void U%s::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const\n"), *Schema.AttributeSetClassName);
+	Repl += TEXT("{\n");
+	Repl += TEXT("\tSuper::GetLifetimeReplicatedProps(OutLifetimeProps);\n\n");
+	Repl += TEXT("\t//GEN-BEGIN: Replication Setup\n");
+	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	{
+		if (Attr.bReplicates && Attr.IsArray())
+		{
+			// WHY: Fast arrays delta replicate per element; REPNOTIFY conditions do not apply
+			Repl += FString::Printf(TEXT("\tDOREPLIFETIME(U%s, %s);\n"), *Schema.AttributeSetClassName, *Attr.AttributeName);
+		}
+		else if (Attr.bReplicates && !Attr.IsFlag())
+		{
+			// NOTE: Flags replicate through UGasXFlagAttributeSet::FlagBits, registered by Super
+			Repl += FString::Printf(TEXT("\tDOREPLIFETIME_CONDITION_NOTIFY(U%s, %s, COND_None, REPNOTIFY_Always);\n"),
+									*Schema.AttributeSetClassName, *Attr.AttributeName);
+		}
+	}
+	Repl += TEXT("\t//GEN-END: Replication Setup\n");
+	Repl += TEXT("}\n");
+	return Repl;
+}
+
+FString FGasXAttributeSetEmitter::GenerateInitEffectDeclaration(const FGasXAttributeSetSchema &Schema) const
+{
+	// WHY: The region is always emitted so turning bGenerateInitGameplayEffect off removes the class on the next merge
+	FString Decl = TEXT("//GEN-BEGIN: Init GameplayEffect\n");
+	if (Schema.bGenerateInitGameplayEffect)
+	{
+		Decl += TEXT("/**\n");
+		Decl += FString::Printf(TEXT(" * Generated init GameplayEffect for U%s.\n"), *Schema.AttributeSetClassName);
+		Decl += TEXT(" * Instant effect that overrides every attribute's base value with its schema default.\n");
+		Decl += TEXT(" */\n");
+		Decl += TEXT("UCLASS()\n");
+		Decl += FString::Printf(TEXT("class %s_API UGE_Init%s : public UGameplayEffect\n"), *Schema.TargetModule.ToUpper(), *Schema.AttributeSetClassName);
+		Decl += TEXT("{\n");
+		Decl += TEXT("\tGENERATED_BODY()\n\n");
+		Decl += TEXT("public:\n");
+		Decl += FString::Printf(TEXT("\tUGE_Init%s();\n"), *Schema.AttributeSetClassName);
+		Decl += TEXT("};\n");
+	}
+	Decl += TEXT("//GEN-END: Init GameplayEffect\n");
+	return Decl;
+}
+
+FString FGasXAttributeSetEmitter::GenerateInitEffectImplementation(const FGasXAttributeSetSchema &Schema) const
+{
+	FString Impl = TEXT("//GEN-BEGIN: Init GameplayEffect\n");
+	if (Schema.bGenerateInitGameplayEffect)
+	{
+		const FString EffectClassName = FString::Printf(TEXT("UGE_Init%s"), *Schema.AttributeSetClassName);
+		Impl += FString::Printf(TEXT("%s::%s()\n"), *EffectClassName, *EffectClassName);
+		Impl += TEXT("{\n");
+		Impl += TEXT("\tDurationPolicy = EGameplayEffectDurationType::Instant;\n");
+		for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+		{
+			if (!Attr.IsGameplayAttribute())
+			{
+				continue;
+			}
+
+			// WHY: Bind through the generated getter so the modifier always targets the live property
+			Impl += TEXT("\n");
+			Impl += FString::Printf(TEXT("\tFGameplayModifierInfo& %sModifier = Modifiers.AddDefaulted_GetRef();\n"), *Attr.AttributeName);
+			Impl += FString::Printf(TEXT("\t%sModifier.Attribute = U%s::Get%sAttribute();\n"), *Attr.AttributeName, *Schema.AttributeSetClassName, *Attr.AttributeName);
+			Impl += FString::Printf(TEXT("\t%sModifier.ModifierOp = EGameplayModOp::Override;\n"), *Attr.AttributeName);
+			Impl += FString::Printf(TEXT("\t%sModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(%.2ff));\n"), *Attr.AttributeName, Attr.DefaultValue);
+		}
+		Impl += TEXT("}\n");
+	}
+	Impl += TEXT("//GEN-END: Init GameplayEffect\n");
+	return Impl;
+}
+
+FString FGasXAttributeSetEmitter::GenerateInitAttributeRegistration(const FGasXAttributeSetSchema &Schema) const
+{
+	FString Reg = TEXT("//GEN-BEGIN: Init Attribute Registration\n");
+	if (Schema.bGenerateInitGameplayEffect)
+	{
+		const FString& SetName = Schema.AttributeSetClassName;
+		Reg += FString::Printf(TEXT("namespace %sInit\n"), *SetName);
+		Reg += TEXT("{\n");
+		for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+		{
+			if (Attr.IsGameplayAttribute())
+			{
+				Reg += FString::Printf(TEXT("\tUE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_%s, \"GasX.SetByCaller.%s.%s\");\n"), *Attr.AttributeName, *SetName, *Attr.AttributeName);
+			}
+		}
+		Reg += TEXT("\n");
+		Reg += TEXT("\tstatic void Describe(TArray<FGasXInitAttribute>& OutAttributes)\n");
+		Reg += TEXT("\t{\n");
+		for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+		{
+			if (Attr.IsGameplayAttribute())
+			{
+				Reg += FString::Printf(TEXT("\t\tOutAttributes.Add({U%s::Get%sAttribute(), TAG_%s, %.2ff});\n"), *SetName, *Attr.AttributeName, *Attr.AttributeName, Attr.DefaultValue);
+			}
+		}
+		Reg += TEXT("\t}\n\n");
+		Reg += FString::Printf(TEXT("\tstatic FGasXInitAttributeRegistration Registration(&U%s::StaticClass, &Describe);\n"), *SetName);
+		Reg += TEXT("}\n");
+	}
+	Reg += TEXT("//GEN-END: Init Attribute Registration\n");
+	return Reg;
+}
+
+FString FGasXAttributeSetEmitter::GenerateFlagDeclarations(const FGasXAttributeSetSchema &Schema) const
+{
+	FString Decl = TEXT("\t//GEN-BEGIN: Attribute Flags\n");
+	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	{
+		if (!Attr.IsFlag())
+		{
+			continue;
+		}
+
+		const TCHAR *Name = *Attr.AttributeName;
+		if (!Attr.Description.IsEmpty())
+		{
+			Decl += FString::Printf(TEXT("\t/** %s */\n"), *Attr.Description);
+		}
+		Decl += FString::Printf(TEXT("\tstatic constexpr uint64 %sFlag = 1ull << %d;\n"), Name, GasXAttributeSetEmitter::GetFlagIndex(Schema, Attr));
+		Decl += FString::Printf(TEXT("\tbool Is%s() const { return TestFlagBits(%sFlag); }\n"), Name, Name);
+		Decl += FString::Printf(TEXT("\tvoid Set%s(bool bValue) { SetFlagBits(%sFlag, bValue); }\n\n"), Name, Name);
+	}
+	if (GasXAttributeSetEmitter::HasFlags(Schema))
+	{
+		Decl += TEXT("\tvirtual TConstArrayView<FName> GetFlagNames() const override;\n");
+	}
+	Decl += TEXT("\t//GEN-END: Attribute Flags\n\n");
+	return Decl;
+}
+
+FString FGasXAttributeSetEmitter::GenerateFlagImplementation(const FGasXAttributeSetSchema &Schema) const
+{
+	FString Impl = TEXT("//GEN-BEGIN: Attribute Flags\n");
+	if (GasXAttributeSetEmitter::HasFlags(Schema))
+	{
+		Impl += FString::Printf(TEXT("TConstArrayView<FName> U%s::GetFlagNames() const\n"), *Schema.AttributeSetClassName);
+		Impl += TEXT("{\n");
+		Impl += TEXT("\tstatic const FName FlagNames[] = {\n");
+		for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+		{
+			if (Attr.IsFlag())
+			{
+				Impl += FString::Printf(TEXT("\t\tTEXT(\"%s\"),\n"), *Attr.AttributeName);
+			}
+		}
+		Impl += TEXT("\t};\n");
+		Impl += TEXT("\treturn FlagNames;\n");
+		Impl += TEXT("}\n");
+	}
+	Impl += TEXT("//GEN-END: Attribute Flags\n");
+	return Impl;
+}
+
+bool FGasXAttributeSetEmitter::EnsureOutputDirectory(const FString &DirectoryPath) const
+{
+	IPlatformFile &PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.DirectoryExists(*DirectoryPath))
+	{
+		return PlatformFile.CreateDirectoryTree(*DirectoryPath);
+	}
+	return true;
+}
+
+bool FGasXAttributeSetEmitter::IsReservedKeyword(const FString &Name) const
+{
+	static const TSet<FString> ReservedKeywords = {
+		TEXT("alignas"), TEXT("alignof"), TEXT("and"), TEXT("and_eq"), TEXT("asm"), TEXT("auto"),
+		TEXT("bitand"), TEXT("bitor"), TEXT("bool"), TEXT("break"), TEXT("case"), TEXT("catch"),
+		TEXT("char"), TEXT("char16_t"), TEXT("char32_t"), TEXT("class"), TEXT("compl"), TEXT("const"),
+		TEXT("constexpr"), TEXT("const_cast"), TEXT("continue"), TEXT("decltype"), TEXT("default"),
+		TEXT("delete"), TEXT("do"), TEXT("double"), TEXT("dynamic_cast"), TEXT("else"), TEXT("enum"),
+		TEXT("explicit"), TEXT("export"), TEXT("extern"), TEXT("false"), TEXT("float"), TEXT("for"),
+		TEXT("friend"), TEXT("goto"), TEXT("if"), TEXT("inline"), TEXT("int"), TEXT("long"),
+		TEXT("mutable"), TEXT("namespace"), TEXT("new"), TEXT("noexcept"), TEXT("not"), TEXT("not_eq"),
+		TEXT("nullptr"), TEXT("operator"), TEXT("or"), TEXT("or_eq"), TEXT("private"), TEXT("protected"),
+		TEXT("public"), TEXT("register"), TEXT("reinterpret_cast"), TEXT("return"), TEXT("short"),
+		TEXT("signed"), TEXT("sizeof"), TEXT("static"), TEXT("static_assert"), TEXT("static_cast"),
+		TEXT("struct"), TEXT("switch"), TEXT("template"), TEXT("this"), TEXT("thread_local"),
+		TEXT("throw"), TEXT("true"), TEXT("try"), TEXT("typedef"), TEXT("typeid"), TEXT("typename"),
+		TEXT("union"), TEXT("unsigned"), TEXT("using"), TEXT("virtual"), TEXT("void"), TEXT("volatile"),
+		TEXT("wchar_t"), TEXT("while"), TEXT("xor"), TEXT("xor_eq")};
+
+	return ReservedKeywords.Contains(Name.ToLower());
+}
+
+bool FGasXAttributeSetEmitter::IsValidIdentifier(const FString &Name) const
+{
+	if (Name.IsEmpty())
+	{
+		return false;
+	}
+
+	// First character must be letter or underscore
+	TCHAR FirstChar = Name[0];
+	if (!FChar::IsAlpha(FirstChar) && FirstChar != TEXT('_'))
+	{
+		return false;
+	}
+
+	// Remaining characters must be alphanumeric or underscore
+	for (int32 i = 1; i < Name.Len(); ++i)
+	{
+		TCHAR Ch = Name[i];
+		if (!FChar::IsAlnum(Ch) && Ch != TEXT('_'))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+FString FGasXAttributeSetEmitter::MergeWithExistingFile(const FString &FilePath, const FString &NewGeneratedContent) const
+{
+	// WHY: If file doesn't exist, this is first generation - use new content as-is
+	if (!FPaths::FileExists(FilePath))
+	{
+		UE_LOG(LogGasXAttributeSetEmitter, Log, TEXT("Creating new file: %s"), *FilePath);
+		return NewGeneratedContent;
+	}
+
+	FString ExistingContent;
+	if (!FFileHelper::LoadFileToString(ExistingContent, *FilePath))
+	{
+		UE_LOG(LogGasXAttributeSetEmitter, Warning, TEXT("Could not read existing file: %s. Using new content."), *FilePath);
+		return NewGeneratedContent;
+	}
+
+	UE_LOG(LogGasXAttributeSetEmitter, Log, TEXT("Merging with existing file: %s"), *FilePath);
+
+	// Start from the existing file so custom code outside guarded regions stays untouched
+	return ReplaceGuardedRegions(ExistingContent, NewGeneratedContent);
+}
+
+bool FGasXAttributeSetEmitter::WriteFileIfChanged(const FString &FilePath, const FString &Content) const
+{
+	FString ExistingContent;
+	if (FPaths::FileExists(FilePath) && FFileHelper::LoadFileToString(ExistingContent, *FilePath) && ExistingContent.Equals(Content, ESearchCase::CaseSensitive))
+	{
+		UE_LOG(LogGasXAttributeSetEmitter, Verbose, TEXT("Output unchanged, skipping write: %s"), *FilePath);
+		return true;
+	}
+
+	return FFileHelper::SaveStringToFile(Content, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+FString FGasXAttributeSetEmitter::ReplaceGuardedRegions(const FString &ExistingContent, const FString &NewContent) const
+{
+	// WHY: Preserve developer code outside guarded regions by editing the existing file in-place.
+	FString Result = ExistingContent;
+	struct FGuardBlock
+	{
+		FString Name;
+		FString BlockText;
+		bool bTopLevel = false;
+	};
+
+	TArray<FGuardBlock> NewBlocks;
+	const FString BeginSignature = TEXT("//GEN-BEGIN:");
+	int32 SearchPosition = 0;
+
+	while (SearchPosition < NewContent.Len())
+	{
+		const int32 BeginIndex = NewContent.Find(BeginSignature, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchPosition);
+		if (BeginIndex == INDEX_NONE)
+		{
+			break;
+		}
+
+		const int32 BeginLineEnd = NewContent.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, BeginIndex);
+		const int32 SafeBeginLineEnd = BeginLineEnd == INDEX_NONE ? NewContent.Len() : BeginLineEnd + 1;
+
+		FString RegionName = NewContent.Mid(BeginIndex + BeginSignature.Len(), SafeBeginLineEnd - (BeginIndex + BeginSignature.Len()));
+		RegionName = RegionName.TrimStartAndEnd();
+
+		const FString EndMarker = FString::Printf(TEXT("//GEN-END: %s"), *RegionName);
+		const int32 EndIndex = NewContent.Find(EndMarker, ESearchCase::CaseSensitive, ESearchDir::FromStart, SafeBeginLineEnd);
+		if (EndIndex == INDEX_NONE)
+		{
+			break;
+		}
+
+		const int32 EndLineEnd = NewContent.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, EndIndex);
+		const int32 SafeEndLineEnd = EndLineEnd == INDEX_NONE ? NewContent.Len() : EndLineEnd + 1;
+
+		const int32 BeginLineStart = NewContent.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromEnd, BeginIndex) + 1;
+		NewBlocks.Add({RegionName, NewContent.Mid(BeginIndex, SafeEndLineEnd - BeginIndex), BeginLineStart == BeginIndex});
+		SearchPosition = SafeEndLineEnd;
+	}
+
+	if (NewBlocks.Num() == 0)
+	{
+		return NewContent;
+	}
+
+	// WHY: New generated features may need headers the existing file predates. Include lines sit outside the
+	// guarded regions (the .generated.h include must come last), so missing ones are merged line by line.
+	MergeIncludeLines(Result, NewContent);
+	MergeBaseClasses(Result, NewContent);
+
+	int32 PreviousBlockEnd = INDEX_NONE;
+	for (const FGuardBlock &Block : NewBlocks)
+	{
+		const FString BeginNeedle = FString::Printf(TEXT("GEN-BEGIN: %s"), *Block.Name);
+		const FString EndNeedle = FString::Printf(TEXT("GEN-END: %s"), *Block.Name);
+
+		const int32 BeginNeedleIndex = Result.Find(BeginNeedle, ESearchCase::CaseSensitive);
+		const int32 EndNeedleIndex = BeginNeedleIndex == INDEX_NONE ? INDEX_NONE : Result.Find(EndNeedle, ESearchCase::CaseSensitive, ESearchDir::FromStart, BeginNeedleIndex);
+		if (EndNeedleIndex == INDEX_NONE)
+		{
+			// WHY: Regions added by newer generator versions must appear in files generated before them.
+			// Top-level regions (whole classes or functions) go at the end of the file; indented regions
+			// follow the previous region so they land in the same class body.
+			if (Block.bTopLevel || PreviousBlockEnd == INDEX_NONE)
+			{
+				if (!Result.IsEmpty() && !Result.EndsWith(TEXT("\n")))
+				{
+					Result += TEXT("\n");
+				}
+				Result += TEXT("\n");
+				Result += Block.BlockText;
+				PreviousBlockEnd = Result.Len();
+			}
+			else
+			{
+				Result.InsertAt(PreviousBlockEnd, Block.BlockText);
+				PreviousBlockEnd += Block.BlockText.Len();
+			}
+			continue;
+		}
+
+		const int32 BlockStartLine = [&Result](int32 Index)
+		{
+			const int32 PrevNewline = Result.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromEnd, Index);
+			return PrevNewline == INDEX_NONE ? 0 : PrevNewline + 1;
+		}(BeginNeedleIndex);
+
+		const int32 BlockEndLine = [&Result](int32 Index)
+		{
+			int32 NextNewline = Result.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index);
+			return NextNewline == INDEX_NONE ? Result.Len() : NextNewline + 1;
+		}(EndNeedleIndex);
+
+		Result = Result.Left(BlockStartLine) + Block.BlockText + Result.Mid(BlockEndLine);
+		PreviousBlockEnd = BlockStartLine + Block.BlockText.Len();
+	}
+
+	return Result;
+}
+
+void FGasXAttributeSetEmitter::MergeBaseClasses(FString &InOutContent, const FString &NewContent) const
+{
+	const FString BaseSeparator = TEXT(" : public ");
+
+	TArray<FString> NewLines;
+	NewContent.ParseIntoArrayLines(NewLines, /*bCullEmpty*/ false);
+
+	for (const FString &NewLine : NewLines)
+	{
+		const int32 SeparatorIndex = NewLine.Find(BaseSeparator, ESearchCase::CaseSensitive);
+		if (!NewLine.StartsWith(TEXT("class ")) || SeparatorIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// WHY: Match on "class API UName : public " so only the base class of the same generated class is rewritten
+		const FString Prefix = NewLine.Left(SeparatorIndex + BaseSeparator.Len());
+		const int32 ExistingIndex = InOutContent.Find(Prefix, ESearchCase::CaseSensitive);
+		if (ExistingIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		int32 ExistingLineEnd = InOutContent.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, ExistingIndex);
+		ExistingLineEnd = ExistingLineEnd == INDEX_NONE ? InOutContent.Len() : ExistingLineEnd;
+		if (InOutContent.Mid(ExistingIndex, ExistingLineEnd - ExistingIndex).TrimEnd() != NewLine.TrimEnd())
+		{
+			InOutContent = InOutContent.Left(ExistingIndex) + NewLine + InOutContent.Mid(ExistingLineEnd);
+		}
+	}
+}
+
+void FGasXAttributeSetEmitter::MergeIncludeLines(FString &InOutContent, const FString &NewContent) const
+{
+	TArray<FString> NewLines;
+	NewContent.ParseIntoArrayLines(NewLines, /*bCullEmpty*/ false);
+
+	FString MissingIncludes;
+	for (const FString &Line : NewLines)
+	{
+		if (Line.StartsWith(TEXT("#include")) && !InOutContent.Contains(Line, ESearchCase::CaseSensitive))
+		{
+			MissingIncludes += Line + TEXT("\n");
+		}
+	}
+
+	if (MissingIncludes.IsEmpty())
+	{
+		return;
+	}
+
+	// WHY: UHT requires the .generated.h include to stay last, so insert before it when present
+	int32 InsertIndex = InOutContent.Find(TEXT(".generated.h\""), ESearchCase::CaseSensitive);
+	if (InsertIndex != INDEX_NONE)
+	{
+		InsertIndex = InOutContent.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromEnd, InsertIndex) + 1;
+	}
+	else
+	{
+		const int32 LastInclude = InOutContent.Find(TEXT("#include"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+		const int32 LineEnd = LastInclude == INDEX_NONE ? INDEX_NONE : InOutContent.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, LastInclude);
+		InsertIndex = LineEnd == INDEX_NONE ? 0 : LineEnd + 1;
+	}
+
+	InOutContent.InsertAt(InsertIndex, MissingIncludes);
+}
@@ -0,0 +1,5 @@
+// Copyright Epic Games, Inc.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, GasXCodeGen)
@@ -0,0 +1,319 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXSchemaGraph.h"
+#include "Misc/Paths.h"
+
+FString FGasXSchemaGraph::NormalizePath(const FString& SchemaFile)
+{
+	FString Normalized = FPaths::ConvertRelativePathToFull(SchemaFile);
+	FPaths::NormalizeFilename(Normalized);
+	FPaths::CollapseRelativeDirectories(Normalized);
+	return Normalized;
+}
+
+void FGasXSchemaGraph::AddSchemas(const TArray<FString>& SchemaFiles, const FString& CacheDirectory)
+{
+	TArray<FString> ToLoad;
+	for (const FString& SchemaFile : SchemaFiles)
+	{
+		const FString Path = NormalizePath(SchemaFile);
+		if (!Nodes.Contains(Path))
+		{
+			ToLoad.AddUnique(Path);
+		}
+	}
+
+	// WHY: After Invalidate(), surviving nodes may reference files that were dropped and must be reloaded
+	for (const TPair<FString, FNode>& Pair : Nodes)
+	{
+		for (const FString& Reference : Pair.Value.References)
+		{
+			if (!Nodes.Contains(Reference))
+			{
+				ToLoad.AddUnique(Reference);
+			}
+		}
+	}
+
+	// WHY: Load breadth-first so every level of references is parsed in one parallel batch
+	while (ToLoad.Num() > 0)
+	{
+		TArray<FGasXSchemaParseResult> Results = FGasXSchemaParser::LoadSchemas(ToLoad, CacheDirectory);
+
+		TArray<FString> NextToLoad;
+		for (int32 Index = 0; Index < ToLoad.Num(); ++Index)
+		{
+			const FString& Path = ToLoad[Index];
+			FNode& Node = Nodes.Add(Path);
+			Node.ParseResult = MoveTemp(Results[Index]);
+			if (!Node.ParseResult.bSuccess)
+			{
+				continue;
+			}
+
+			const FString BaseDir = FPaths::GetPath(Path);
+			auto AddReference = [&](const FString& ReferencedFile)
+			{
+				const FString Reference = NormalizePath(FPaths::IsRelative(ReferencedFile) ? BaseDir / ReferencedFile : ReferencedFile);
+				Node.References.Add(Reference);
+				if (!Nodes.Contains(Reference) && !ToLoad.Contains(Reference))
+				{
+					NextToLoad.AddUnique(Reference);
+				}
+			};
+
+			const FGasXAttributeSetSchema& Parsed = Node.ParseResult.Schema;
+			if (!Parsed.Extends.IsEmpty())
+			{
+				AddReference(Parsed.Extends);
+			}
+			for (const FString& Include : Parsed.Includes)
+			{
+				AddReference(Include);
+			}
+		}
+
+		ToLoad = MoveTemp(NextToLoad);
+	}
+
+	ResolveAll();
+}
+
+void FGasXSchemaGraph::Invalidate(const TArray<FString>& ChangedFiles)
+{
+	const TSet<FString> Affected = CollectAffected(ChangedFiles);
+
+	for (const FString& ChangedFile : ChangedFiles)
+	{
+		Nodes.Remove(NormalizePath(ChangedFile));
+	}
+
+	for (TPair<FString, FNode>& Pair : Nodes)
+	{
+		if (Affected.Contains(Pair.Key))
+		{
+			FNode& Node = Pair.Value;
+			Node.bResolved = false;
+			Node.bResolveSucceeded = false;
+			Node.Resolved = FGasXAttributeSetSchema();
+			Node.ResolveDiagnostics.Reset();
+		}
+	}
+}
+
+const FGasXAttributeSetSchema* FGasXSchemaGraph::GetResolvedSchema(const FString& SchemaFile) const
+{
+	const FNode* Node = Nodes.Find(NormalizePath(SchemaFile));
+	return Node && Node->bResolveSucceeded ? &Node->Resolved : nullptr;
+}
+
+TArray<FGasXSchemaDiagnostic> FGasXSchemaGraph::GetDiagnostics(const FString& SchemaFile) const
+{
+	TArray<FGasXSchemaDiagnostic> Diagnostics;
+	TArray<FString> Pending = {NormalizePath(SchemaFile)};
+	TSet<FString> Visited;
+
+	// WHY: Include the diagnostics of referenced files so a broken fragment is reported where it actually is
+	while (Pending.Num() > 0)
+	{
+		const FString Path = Pending.Pop();
+		if (Visited.Contains(Path))
+		{
+			continue;
+		}
+		Visited.Add(Path);
+
+		if (const FNode* Node = Nodes.Find(Path))
+		{
+			Diagnostics.Append(Node->ParseResult.Diagnostics);
+			Diagnostics.Append(Node->ResolveDiagnostics);
+			Pending.Append(Node->References);
+		}
+	}
+
+	return Diagnostics;
+}
+
+bool FGasXSchemaGraph::WasLoadedFromCache(const FString& SchemaFile) const
+{
+	const FNode* Node = Nodes.Find(NormalizePath(SchemaFile));
+	return Node && Node->ParseResult.bFromCache;
+}
+
+TArray<FString> FGasXSchemaGraph::GetDependentSchemas(const TArray<FString>& ChangedFiles) const
+{
+	TArray<FString> Dependents;
+	for (const FString& Path : CollectAffected(ChangedFiles))
+	{
+		const FNode* Node = Nodes.Find(Path);
+		if (Node && !Node->ParseResult.Schema.bIsFragment)
+		{
+			Dependents.Add(Path);
+		}
+	}
+
+	Dependents.Sort();
+	return Dependents;
+}
+
+TSet<FString> FGasXSchemaGraph::CollectAffected(const TArray<FString>& ChangedFiles) const
+{
+	TSet<FString> Affected;
+	for (const FString& ChangedFile : ChangedFiles)
+	{
+		Affected.Add(NormalizePath(ChangedFile));
+	}
+
+	// WHY: Schema graphs are small (dozens of files), so a fixed-point sweep is simpler than maintaining reverse edges
+	bool bGrew = true;
+	while (bGrew)
+	{
+		bGrew = false;
+		for (const TPair<FString, FNode>& Pair : Nodes)
+		{
+			if (Affected.Contains(Pair.Key))
+			{
+				continue;
+			}
+
+			for (const FString& Reference : Pair.Value.References)
+			{
+				if (Affected.Contains(Reference))
+				{
+					Affected.Add(Pair.Key);
+					bGrew = true;
+					break;
+				}
+			}
+		}
+	}
+
+	return Affected;
+}
+
+TArray<FString> FGasXSchemaGraph::GetGeneratableSchemas() const
+{
+	TArray<FString> Schemas;
+	for (const TPair<FString, FNode>& Pair : Nodes)
+	{
+		if (Pair.Value.ParseResult.bSuccess && !Pair.Value.ParseResult.Schema.bIsFragment)
+		{
+			Schemas.Add(Pair.Key);
+		}
+	}
+
+	Schemas.Sort();
+	return Schemas;
+}
+
+void FGasXSchemaGraph::ResolveAll()
+{
+	TArray<FString> Paths;
+	Nodes.GetKeys(Paths);
+
+	TArray<FString> Visiting;
+	for (const FString& Path : Paths)
+	{
+		Resolve(Path, Visiting);
+	}
+}
+
+bool FGasXSchemaGraph::Resolve(const FString& Path, TArray<FString>& Visiting)
+{
+	// NOTE: Resolution never adds nodes, so node pointers stay valid across recursion
+	FNode* Node = Nodes.Find(Path);
+	if (!Node)
+	{
+		return false;
+	}
+
+	if (Node->bResolved)
+	{
+		return Node->bResolveSucceeded;
+	}
+
+	Node->bResolved = true;
+	Node->bResolveSucceeded = false;
+	Node->ResolveDiagnostics.Reset();
+
+	if (!Node->ParseResult.bSuccess)
+	{
+		return false;
+	}
+
+	Visiting.Push(Path);
+
+	FGasXAttributeSetSchema Resolved = Node->ParseResult.Schema;
+	Resolved.Attributes.Reset();
+	Resolved.Extends.Reset();
+	Resolved.Includes.Reset();
+
+	bool bSucceeded = true;
+	for (const FString& Reference : Node->References)
+	{
+		if (Visiting.Contains(Reference))
+		{
+			Node->ResolveDiagnostics.Add(MakeDiagnostic(Path, FString::Printf(TEXT("Circular Extends/Include: %s -> %s"), *FString::Join(Visiting, TEXT(" -> ")), *Reference)));
+			bSucceeded = false;
+			continue;
+		}
+
+		const FNode* ReferencedNode = Nodes.Find(Reference);
+		if (!ReferencedNode || !Resolve(Reference, Visiting))
+		{
+			Node->ResolveDiagnostics.Add(MakeDiagnostic(Path, FString::Printf(TEXT("Referenced schema failed to load or resolve: %s"), *Reference)));
+			bSucceeded = false;
+			continue;
+		}
+
+		MergeAttributes(Resolved.Attributes, ReferencedNode->Resolved.Attributes);
+	}
+
+	MergeAttributes(Resolved.Attributes, Node->ParseResult.Schema.Attributes);
+
+	Visiting.Pop();
+
+	if (bSucceeded && !Resolved.bIsFragment && Resolved.Attributes.Num() == 0)
+	{
+		Node->ResolveDiagnostics.Add(MakeDiagnostic(Path, TEXT("Schema resolves to no attributes")));
+		bSucceeded = false;
+	}
+
+	if (bSucceeded)
+	{
+		Node->Resolved = MoveTemp(Resolved);
+	}
+
+	Node->bResolveSucceeded = bSucceeded;
+	return bSucceeded;
+}
+
+void FGasXSchemaGraph::MergeAttributes(TArray<FGasXAttributeDefinition>& Into, const TArray<FGasXAttributeDefinition>& From)
+{
+	for (const FGasXAttributeDefinition& Attr : From)
+	{
+		const int32 ExistingIndex = Into.IndexOfByPredicate([&Attr](const FGasXAttributeDefinition& Existing)
+		{
+			return Existing.AttributeName.Equals(Attr.AttributeName, ESearchCase::IgnoreCase);
+		});
+
+		if (ExistingIndex != INDEX_NONE)
+		{
+			Into[ExistingIndex] = Attr;
+		}
+		else
+		{
+			Into.Add(Attr);
+		}
+	}
+}
+
+FGasXSchemaDiagnostic FGasXSchemaGraph::MakeDiagnostic(const FString& File, const FString& Message)
+{
+	FGasXSchemaDiagnostic Diagnostic;
+	Diagnostic.File = File;
+	Diagnostic.Line = 1;
+	Diagnostic.Column = 1;
+	Diagnostic.Message = Message;
+	return Diagnostic;
+}
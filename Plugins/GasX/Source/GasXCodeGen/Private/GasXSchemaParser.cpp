@@ -0,0 +1,693 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXSchemaParser.h"
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXSchemaParser, Log, All);
+
+// WHY: Parse cache serialization, field by field; the schema structs are plain C++ with no reflection to lean on.
+// NOTE: At global scope so TArray's operator<< finds the element overloads.
+static FArchive& operator<<(FArchive& Ar, FGasXLevelCurveKey& Key)
+{
+	return Ar << Key.Level << Key.Value;
+}
+
+static FArchive& operator<<(FArchive& Ar, FGasXAttributeDefinition& Attribute)
+{
+	return Ar << Attribute.AttributeName << Attribute.AttributeType << Attribute.DefaultValue << Attribute.MinValue << Attribute.MaxValue
+		<< Attribute.bReplicates << Attribute.bRepNotify << Attribute.Description << Attribute.LevelCurve << Attribute.ArraySize;
+}
+
+static FArchive& operator<<(FArchive& Ar, FGasXAttributeSetSchema& Schema)
+{
+	return Ar << Schema.AttributeSetClassName << Schema.TargetModule << Schema.TargetDirectory << Schema.Attributes
+		<< Schema.bGenerateInitGameplayEffect << Schema.bGenerateMetadataTable << Schema.bJournal << Schema.Description
+		<< Schema.bIsFragment << Schema.Extends << Schema.Includes;
+}
+
+namespace GasXSchemaParserPrivate
+{
+	/** Identifies a GasX schema cache file. */
+	constexpr uint32 CacheMagic = 0x47585343; // 'GXSC'
+
+	/**
+	 * Bump whenever FGasXAttributeSetSchema, the parser's defaults or the cache layout change.
+	 * WHY: Cached entries are keyed by file content only, so a parser change must invalidate them explicitly.
+	 */
+	constexpr uint32 CacheFormatVersion = 6;
+
+	/**
+	 * Streaming schema reader that tracks source positions for diagnostics.
+	 *
+	 * WHY: The DOM API discards positions, so errors could only say "Failed to parse JSON".
+	 * Reading through our own archive lets us map the stream offset back to line:column.
+	 */
+	class FSchemaReader
+	{
+	public:
+		FSchemaReader(const FString& JsonString, const FString& InSourceName, TArray<FGasXSchemaDiagnostic>& InDiagnostics)
+			: Bytes(reinterpret_cast<const uint8*>(*JsonString), JsonString.Len() * sizeof(TCHAR))
+			, Archive(Bytes)
+			, Reader(TJsonReader<TCHAR>::Create(&Archive))
+			, Text(JsonString)
+			, SourceName(InSourceName)
+			, Diagnostics(InDiagnostics)
+		{
+			LineStarts.Add(0);
+			for (int32 Index = 0; Index < Text.Len(); ++Index)
+			{
+				if (Text[Index] == TEXT('\n'))
+				{
+					LineStarts.Add(Index + 1);
+				}
+			}
+		}
+
+		bool ParseSchema(FGasXAttributeSetSchema& OutSchema)
+		{
+			EJsonNotation Notation;
+			if (!Next(Notation))
+			{
+				return false;
+			}
+
+			if (Notation != EJsonNotation::ObjectStart)
+			{
+				AddError(TEXT("Schema root must be a JSON object"));
+				return false;
+			}
+
+			bool bHasVersion = false;
+			bool bHasClassName = false;
+			bool bHasAttributes = false;
+
+			while (!bAborted)
+			{
+				if (!Next(Notation))
+				{
+					return false;
+				}
+
+				if (Notation == EJsonNotation::ObjectEnd)
+				{
+					break;
+				}
+
+				const FString Field = Reader->GetIdentifier();
+				if (Field == TEXT("SchemaVersion"))
+				{
+					double Version = 0.0;
+					if (ReadNumber(Notation, Field, Version))
+					{
+						bHasVersion = true;
+						if (Version != FMath::FloorToDouble(Version) || Version < 1.0)
+						{
+							AddError(FString::Printf(TEXT("SchemaVersion must be a positive integer, got %g"), Version));
+						}
+						else if (Version > FGasXSchemaParser::CurrentSchemaVersion)
+						{
+							AddError(FString::Printf(TEXT("SchemaVersion %d is newer than this parser supports (%d)"), static_cast<int32>(Version), FGasXSchemaParser::CurrentSchemaVersion));
+						}
+					}
+				}
+				else if (Field == TEXT("AttributeSetClassName"))
+				{
+					bHasClassName = ReadString(Notation, Field, OutSchema.AttributeSetClassName);
+				}
+				else if (Field == TEXT("TargetModule"))
+				{
+					ReadString(Notation, Field, OutSchema.TargetModule);
+				}
+				else if (Field == TEXT("TargetDirectory"))
+				{
+					ReadString(Notation, Field, OutSchema.TargetDirectory);
+				}
+				else if (Field == TEXT("Description"))
+				{
+					ReadString(Notation, Field, OutSchema.Description);
+				}
+				else if (Field == TEXT("bGenerateInitGameplayEffect"))
+				{
+					ReadBool(Notation, Field, OutSchema.bGenerateInitGameplayEffect);
+				}
+				else if (Field == TEXT("bGenerateMetadataTable"))
+				{
+					ReadBool(Notation, Field, OutSchema.bGenerateMetadataTable);
+				}
+				else if (Field == TEXT("bJournal"))
+				{
+					ReadBool(Notation, Field, OutSchema.bJournal);
+				}
+				else if (Field == TEXT("Attributes"))
+				{
+					bHasAttributes = ParseAttributes(Notation, OutSchema.Attributes);
+				}
+				else if (Field == TEXT("bIsFragment"))
+				{
+					ReadBool(Notation, Field, OutSchema.bIsFragment);
+				}
+				else if (Field == TEXT("Extends"))
+				{
+					ReadString(Notation, Field, OutSchema.Extends);
+				}
+				else if (Field == TEXT("Include"))
+				{
+					ParseIncludes(Notation, OutSchema.Includes);
+				}
+				else
+				{
+					AddWarning(FString::Printf(TEXT("Unknown schema field '%s' ignored"), *Field));
+					SkipValue(Notation);
+				}
+			}
+
+			if (bAborted)
+			{
+				return false;
+			}
+
+			if (!bHasVersion)
+			{
+				AddWarning(FString::Printf(TEXT("Missing 'SchemaVersion'; assuming %d"), FGasXSchemaParser::CurrentSchemaVersion));
+			}
+
+			if (!bHasClassName && !OutSchema.bIsFragment)
+			{
+				AddError(TEXT("Missing required field 'AttributeSetClassName' (or set 'bIsFragment' for shared fragments)"));
+			}
+
+			// WHY: A schema that inherits or includes attributes may legitimately declare none of its own
+			const bool bInheritsAttributes = !OutSchema.Extends.IsEmpty() || OutSchema.Includes.Num() > 0;
+			if (!bHasAttributes && !bInheritsAttributes)
+			{
+				AddError(TEXT("Missing required 'Attributes' array"));
+			}
+			else if (bHasAttributes && OutSchema.Attributes.Num() == 0 && !bInheritsAttributes)
+			{
+				AddError(TEXT("'Attributes' array must contain at least one attribute"));
+			}
+
+			return NumErrors == 0;
+		}
+
+	private:
+		bool ParseAttributes(EJsonNotation Notation, TArray<FGasXAttributeDefinition>& OutAttributes)
+		{
+			if (Notation != EJsonNotation::ArrayStart)
+			{
+				AddError(TEXT("'Attributes' must be an array"));
+				SkipValue(Notation);
+				return false;
+			}
+
+			while (!bAborted)
+			{
+				if (!Next(Notation))
+				{
+					return false;
+				}
+
+				if (Notation == EJsonNotation::ArrayEnd)
+				{
+					return true;
+				}
+
+				if (Notation != EJsonNotation::ObjectStart)
+				{
+					AddError(FString::Printf(TEXT("Attribute %d must be a JSON object"), OutAttributes.Num()));
+					SkipValue(Notation);
+					continue;
+				}
+
+				FGasXAttributeDefinition& Attr = OutAttributes.AddDefaulted_GetRef();
+				ParseAttribute(Attr, OutAttributes.Num() - 1);
+			}
+
+			return false;
+		}
+
+		void ParseIncludes(EJsonNotation Notation, TArray<FString>& OutIncludes)
+		{
+			if (Notation != EJsonNotation::ArrayStart)
+			{
+				AddError(TEXT("'Include' must be an array of schema file paths"));
+				SkipValue(Notation);
+				return;
+			}
+
+			while (!bAborted)
+			{
+				if (!Next(Notation) || Notation == EJsonNotation::ArrayEnd)
+				{
+					return;
+				}
+
+				FString IncludePath;
+				if (ReadString(Notation, TEXT("Include"), IncludePath))
+				{
+					OutIncludes.Add(IncludePath);
+				}
+			}
+		}
+
+		void ParseLevelCurve(EJsonNotation Notation, TArray<FGasXLevelCurveKey>& OutKeys)
+		{
+			if (Notation != EJsonNotation::ArrayStart)
+			{
+				AddError(TEXT("'LevelCurve' must be an array of { \"Level\": n, \"Value\": n } keys"));
+				SkipValue(Notation);
+				return;
+			}
+
+			while (!bAborted)
+			{
+				if (!Next(Notation) || Notation == EJsonNotation::ArrayEnd)
+				{
+					return;
+				}
+
+				if (Notation != EJsonNotation::ObjectStart)
+				{
+					AddError(FString::Printf(TEXT("LevelCurve key %d must be a JSON object"), OutKeys.Num()));
+					SkipValue(Notation);
+					continue;
+				}
+
+				double Level = 0.0;
+				double Value = 0.0;
+				bool bHasLevel = false;
+				bool bHasValue = false;
+				while (!bAborted && Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+				{
+					const FString Field = Reader->GetIdentifier();
+					if (Field == TEXT("Level"))
+					{
+						bHasLevel = ReadNumber(Notation, Field, Level);
+					}
+					else if (Field == TEXT("Value"))
+					{
+						bHasValue = ReadNumber(Notation, Field, Value);
+					}
+					else
+					{
+						AddWarning(FString::Printf(TEXT("Unknown LevelCurve field '%s' ignored"), *Field));
+						SkipValue(Notation);
+					}
+				}
+
+				if (!bHasLevel || !bHasValue)
+				{
+					AddError(FString::Printf(TEXT("LevelCurve key %d needs both 'Level' and 'Value'"), OutKeys.Num()));
+					continue;
+				}
+
+				FGasXLevelCurveKey& Key = OutKeys.AddDefaulted_GetRef();
+				Key.Level = static_cast<float>(Level);
+				Key.Value = static_cast<float>(Value);
+			}
+		}
+
+		void ParseAttribute(FGasXAttributeDefinition& OutAttr, int32 AttributeIndex)
+		{
+			// WHY: Keep the parser's historical defaults for optional fields; only required fields are errors
+			OutAttr.DefaultValue = 0.0;
+			OutAttr.MinValue = 0.0;
+			OutAttr.MaxValue = 100.0;
+
+			bool bHasName = false;
+			EJsonNotation Notation;
+			while (!bAborted)
+			{
+				if (!Next(Notation))
+				{
+					return;
+				}
+
+				if (Notation == EJsonNotation::ObjectEnd)
+				{
+					break;
+				}
+
+				const FString Field = Reader->GetIdentifier();
+				if (Field == TEXT("AttributeName"))
+				{
+					bHasName = ReadString(Notation, Field, OutAttr.AttributeName) && !OutAttr.AttributeName.IsEmpty();
+				}
+				else if (Field == TEXT("AttributeType"))
+				{
+					ReadString(Notation, Field, OutAttr.AttributeType);
+				}
+				else if (Field == TEXT("DefaultValue"))
+				{
+					ReadNumber(Notation, Field, OutAttr.DefaultValue);
+				}
+				else if (Field == TEXT("MinValue"))
+				{
+					ReadNumber(Notation, Field, OutAttr.MinValue);
+				}
+				else if (Field == TEXT("MaxValue"))
+				{
+					ReadNumber(Notation, Field, OutAttr.MaxValue);
+				}
+				else if (Field == TEXT("bReplicates"))
+				{
+					ReadBool(Notation, Field, OutAttr.bReplicates);
+				}
+				else if (Field == TEXT("bRepNotify"))
+				{
+					ReadBool(Notation, Field, OutAttr.bRepNotify);
+				}
+				else if (Field == TEXT("Description"))
+				{
+					ReadString(Notation, Field, OutAttr.Description);
+				}
+				else if (Field == TEXT("LevelCurve"))
+				{
+					ParseLevelCurve(Notation, OutAttr.LevelCurve);
+				}
+				else if (Field == TEXT("ArraySize"))
+				{
+					double ArraySize = 0.0;
+					if (ReadNumber(Notation, Field, ArraySize))
+					{
+						if (ArraySize != FMath::FloorToDouble(ArraySize) || ArraySize < 0.0)
+						{
+							AddError(FString::Printf(TEXT("ArraySize must be a non-negative integer, got %g"), ArraySize));
+						}
+						else
+						{
+							OutAttr.ArraySize = static_cast<int32>(FMath::Min(ArraySize, static_cast<double>(MAX_int32)));
+						}
+					}
+				}
+				else
+				{
+					AddWarning(FString::Printf(TEXT("Unknown attribute field '%s' ignored"), *Field));
+					SkipValue(Notation);
+				}
+			}
+
+			if (!bHasName && !bAborted)
+			{
+				AddError(FString::Printf(TEXT("Attribute %d is missing a non-empty 'AttributeName'"), AttributeIndex));
+			}
+		}
+
+		bool ReadString(EJsonNotation Notation, const FString& Field, FString& OutValue)
+		{
+			if (Notation != EJsonNotation::String)
+			{
+				AddError(FString::Printf(TEXT("Field '%s' must be a string"), *Field));
+				SkipValue(Notation);
+				return false;
+			}
+			OutValue = Reader->GetValueAsString();
+			return true;
+		}
+
+		bool ReadNumber(EJsonNotation Notation, const FString& Field, double& OutValue)
+		{
+			if (Notation != EJsonNotation::Number)
+			{
+				AddError(FString::Printf(TEXT("Field '%s' must be a number"), *Field));
+				SkipValue(Notation);
+				return false;
+			}
+			OutValue = Reader->GetValueAsNumber();
+			return true;
+		}
+
+		bool ReadBool(EJsonNotation Notation, const FString& Field, bool& OutValue)
+		{
+			if (Notation != EJsonNotation::Boolean)
+			{
+				AddError(FString::Printf(TEXT("Field '%s' must be true or false"), *Field));
+				SkipValue(Notation);
+				return false;
+			}
+			OutValue = Reader->GetValueAsBoolean();
+			return true;
+		}
+
+		void SkipValue(EJsonNotation Notation)
+		{
+			bool bSkipped = true;
+			if (Notation == EJsonNotation::ObjectStart)
+			{
+				bSkipped = Reader->SkipObject();
+			}
+			else if (Notation == EJsonNotation::ArrayStart)
+			{
+				bSkipped = Reader->SkipArray();
+			}
+
+			if (!bSkipped)
+			{
+				AddError(Reader->GetErrorMessage());
+				bAborted = true;
+			}
+		}
+
+		bool Next(EJsonNotation& OutNotation)
+		{
+			if (!Reader->ReadNext(OutNotation) || OutNotation == EJsonNotation::Error)
+			{
+				const FString& ReaderError = Reader->GetErrorMessage();
+				AddError(ReaderError.IsEmpty() ? FString(TEXT("Unexpected end of JSON")) : ReaderError);
+				bAborted = true;
+				return false;
+			}
+			return true;
+		}
+
+		void AddError(const FString& Message)
+		{
+			AddDiagnostic(Message, true);
+			++NumErrors;
+		}
+
+		void AddWarning(const FString& Message)
+		{
+			AddDiagnostic(Message, false);
+		}
+
+		void AddDiagnostic(const FString& Message, bool bIsError)
+		{
+			// WHY: The archive offset is just past the token that triggered the diagnostic
+			const int32 Offset = FMath::Clamp(static_cast<int32>(Archive.Tell() / sizeof(TCHAR)), 0, Text.Len());
+			const int32 LineIndex = FMath::Max(0, Algo::UpperBound(LineStarts, Offset) - 1);
+
+			FGasXSchemaDiagnostic& Diagnostic = Diagnostics.AddDefaulted_GetRef();
+			Diagnostic.File = SourceName;
+			Diagnostic.Line = LineIndex + 1;
+			Diagnostic.Column = Offset - LineStarts[LineIndex] + 1;
+			Diagnostic.Message = Message;
+			Diagnostic.bIsError = bIsError;
+		}
+
+		TArray<uint8> Bytes;
+		FMemoryReader Archive;
+		TSharedRef<TJsonReader<TCHAR>> Reader;
+		const FString& Text;
+		FString SourceName;
+		TArray<FGasXSchemaDiagnostic>& Diagnostics;
+		TArray<int32> LineStarts;
+		int32 NumErrors = 0;
+		bool bAborted = false;
+	};
+}
+
+FString FGasXSchemaDiagnostic::ToString() const
+{
+	return FString::Printf(TEXT("%s(%d:%d): %s: %s"), *File, Line, Column, bIsError ? TEXT("error") : TEXT("warning"), *Message);
+}
+
+FString FGasXSchemaParseResult::GetErrorString() const
+{
+	TArray<FString> Errors;
+	for (const FGasXSchemaDiagnostic& Diagnostic : Diagnostics)
+	{
+		if (Diagnostic.bIsError)
+		{
+			Errors.Add(Diagnostic.ToString());
+		}
+	}
+	return FString::Join(Errors, TEXT("\n"));
+}
+
+bool FGasXSchemaParser::LoadSchemaFromJson(const FString& JsonFilePath, FGasXAttributeSetSchema& OutSchema, FString& OutError, const FString& CacheDirectory)
+{
+	FGasXSchemaParseResult Result = LoadSchema(JsonFilePath, CacheDirectory);
+	for (const FGasXSchemaDiagnostic& Diagnostic : Result.Diagnostics)
+	{
+		if (!Diagnostic.bIsError)
+		{
+			UE_LOG(LogGasXSchemaParser, Warning, TEXT("%s"), *Diagnostic.ToString());
+		}
+	}
+
+	if (!Result.bSuccess)
+	{
+		OutError = Result.GetErrorString();
+		return false;
+	}
+
+	OutSchema = MoveTemp(Result.Schema);
+	return true;
+}
+
+FGasXSchemaParseResult FGasXSchemaParser::LoadSchema(const FString& JsonFilePath, const FString& CacheDirectory)
+{
+	FGasXSchemaParseResult Result;
+	Result.FilePath = JsonFilePath;
+
+	TArray<uint8> FileBytes;
+	if (!FFileHelper::LoadFileToArray(FileBytes, *JsonFilePath))
+	{
+		FGasXSchemaDiagnostic& Diagnostic = Result.Diagnostics.AddDefaulted_GetRef();
+		Diagnostic.File = JsonFilePath;
+		Diagnostic.Message = TEXT("Failed to read file");
+		return Result;
+	}
+
+	const bool bUseCache = !CacheDirectory.IsEmpty();
+	const uint64 ContentHash = FXxHash64::HashBuffer(FileBytes.GetData(), FileBytes.Num()).Hash;
+	if (bUseCache && LoadFromCache(CacheDirectory, ContentHash, Result.Schema))
+	{
+		Result.bSuccess = true;
+		Result.bFromCache = true;
+		return Result;
+	}
+
+	FString JsonString;
+	FFileHelper::BufferToString(JsonString, FileBytes.GetData(), FileBytes.Num());
+
+	Result.bSuccess = ParseSchemaString(JsonString, JsonFilePath, Result.Schema, Result.Diagnostics);
+	if (Result.bSuccess && bUseCache)
+	{
+		SaveToCache(CacheDirectory, ContentHash, Result.Schema);
+	}
+
+	return Result;
+}
+
+TArray<FGasXSchemaParseResult> FGasXSchemaParser::LoadSchemas(const TArray<FString>& JsonFilePaths, const FString& CacheDirectory)
+{
+	TArray<FGasXSchemaParseResult> Results;
+	Results.SetNum(JsonFilePaths.Num());
+
+	ParallelFor(JsonFilePaths.Num(), [&JsonFilePaths, &Results, &CacheDirectory](int32 Index)
+	{
+		Results[Index] = LoadSchema(JsonFilePaths[Index], CacheDirectory);
+	});
+
+	return Results;
+}
+
+bool FGasXSchemaParser::ParseSchemaString(const FString& JsonString, const FString& SourceName, FGasXAttributeSetSchema& OutSchema, TArray<FGasXSchemaDiagnostic>& OutDiagnostics)
+{
+	OutSchema = FGasXAttributeSetSchema();
+	GasXSchemaParserPrivate::FSchemaReader SchemaReader(JsonString, SourceName, OutDiagnostics);
+	return SchemaReader.ParseSchema(OutSchema);
+}
+
+FString FGasXSchemaParser::GetCacheDirectory(const FString& SavedDir)
+{
+	return SavedDir / TEXT("GasX") / TEXT("SchemaCache");
+}
+
+FString FGasXSchemaParser::GetCacheFilePath(const FString& CacheDirectory, uint64 ContentHash)
+{
+	return CacheDirectory / FString::Printf(TEXT("%016llx.gxs"), ContentHash);
+}
+
+bool FGasXSchemaParser::LoadFromCache(const FString& CacheDirectory, uint64 ContentHash, FGasXAttributeSetSchema& OutSchema)
+{
+	TArray<uint8> CacheBytes;
+	if (!FFileHelper::LoadFileToArray(CacheBytes, *GetCacheFilePath(CacheDirectory, ContentHash), FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Ar(CacheBytes);
+	uint32 Magic = 0;
+	uint32 FormatVersion = 0;
+	Ar << Magic << FormatVersion;
+	if (Magic != GasXSchemaParserPrivate::CacheMagic || FormatVersion != GasXSchemaParserPrivate::CacheFormatVersion)
+	{
+		return false;
+	}
+
+	FGasXAttributeSetSchema CachedSchema;
+	Ar << CachedSchema;
+	if (Ar.IsError() || !Ar.AtEnd())
+	{
+		UE_LOG(LogGasXSchemaParser, Verbose, TEXT("Discarding corrupt schema cache entry %016llx"), ContentHash);
+		return false;
+	}
+
+	OutSchema = MoveTemp(CachedSchema);
+	return true;
+}
+
+void FGasXSchemaParser::SaveToCache(const FString& CacheDirectory, uint64 ContentHash, const FGasXAttributeSetSchema& Schema)
+{
+	TArray<uint8> CacheBytes;
+	FMemoryWriter Ar(CacheBytes);
+	uint32 Magic = GasXSchemaParserPrivate::CacheMagic;
+	uint32 FormatVersion = GasXSchemaParserPrivate::CacheFormatVersion;
+	Ar << Magic << FormatVersion;
+	Ar << const_cast<FGasXAttributeSetSchema&>(Schema);
+
+	// WHY: LoadSchemas parses in parallel, and two files with identical content share one entry. Writing to a
+	// unique temp file and moving it into place means readers never see a half-written entry.
+	const FString CacheFilePath = GetCacheFilePath(CacheDirectory, ContentHash);
+	const FString TempFilePath = FPaths::CreateTempFilename(*CacheDirectory, TEXT("Write"), TEXT(".tmp"));
+
+	// WHY: A failed cache write only costs a re-parse next time, so it is not an error
+	if (!FFileHelper::SaveArrayToFile(CacheBytes, *TempFilePath)
+		|| !IFileManager::Get().Move(*CacheFilePath, *TempFilePath, /*bReplace*/ true, /*bEvenIfReadOnly*/ false, /*bAttributes*/ false, /*bDoNotRetryOrError*/ true))
+	{
+		IFileManager::Get().Delete(*TempFilePath, /*bRequireExists*/ false, /*bEvenReadOnly*/ false, /*bQuiet*/ true);
+		UE_LOG(LogGasXSchemaParser, Verbose, TEXT("Could not write schema cache entry %016llx"), ContentHash);
+	}
+}
+
+TArray<FString> FGasXSchemaParser::FindSchemaFiles(const FString& Glob, const FString& BaseDir)
+{
+	FString FullGlob = Glob.TrimQuotes();
+	if (FPaths::IsRelative(FullGlob))
+	{
+		FullGlob = FPaths::ConvertRelativePathToFull(BaseDir, FullGlob);
+	}
+
+	FString Directory = FPaths::GetPath(FullGlob);
+	const FString Wildcard = FPaths::GetCleanFilename(FullGlob);
+
+	TArray<FString> Found;
+	if (Directory.EndsWith(TEXT("/**")))
+	{
+		Directory.LeftChopInline(3);
+		IFileManager::Get().FindFilesRecursive(Found, *Directory, *Wildcard, /*Files*/ true, /*Directories*/ false);
+	}
+	else
+	{
+		IFileManager::Get().FindFiles(Found, *FullGlob, /*Files*/ true, /*Directories*/ false);
+		for (FString& File : Found)
+		{
+			File = Directory / File;
+		}
+	}
+
+	// WHY: Deterministic order keeps logs and timings comparable between runs
+	Found.Sort();
+	return Found;
+}
@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * One key of an attribute's level curve.
+ */
+struct GASXCODEGEN_API FGasXLevelCurveKey
+{
+	/** Character/actor level this key applies to */
+	float Level = 1.0f;
+
+	/** Attribute base value at this level (linearly interpolated between keys) */
+	float Value = 0.0f;
+};
+
+/**
+ * Defines a single GAS Attribute for code generation and data-driven setup.
+ * 
+ * WHY: Centralizes attribute metadata in one place for the schema parser, the code emitter and the
+ * editor's asset generation. Supports replication config and designer-safe value ranges.
+ *
+ * NOTE: Plain structs so the codegen module needs only Core; nothing at runtime reads schemas.
+ */
+struct GASXCODEGEN_API FGasXAttributeDefinition
+{
+	/** Display name of the attribute (e.g., "Health", "Stamina"). Must be valid C++ identifier. */
+	FString AttributeName;
+
+	/** C++ type of the attribute: "float", "int32", or "flag" for a boolean packed into the set's replicated flag bits. */
+	FString AttributeType = TEXT("float");
+
+	/** Default/base value for this attribute */
+	double DefaultValue = 100.0;
+
+	/** Minimum allowed value (used in UI and optional GE clamping) */
+	double MinValue = 0.0;
+
+	/** Maximum allowed value (used in UI and optional GE clamping) */
+	double MaxValue = 100.0;
+
+	/** If true, this attribute replicates to all clients */
+	bool bReplicates = true;
+
+	/** If true, value changes trigger RepNotify (requires OnRep function in generated class) */
+	bool bRepNotify = true;
+
+	/** Description for designer reference (not code-generated, for comments only) */
+	FString Description;
+
+	/**
+	 * Optional per-level base values, sorted by ascending level.
+	 * WHY: Level-scaled defaults are emitted into a CurveTable instead of extra GEs or Blueprint math at spawn.
+	 */
+	TArray<FGasXLevelCurveKey> LevelCurve;
+
+	/**
+	 * If greater than zero, this is an indexed array of ArraySize float elements backed by FGasXAttributeArray.
+	 * WHY: Families of near-identical attributes (resistances, per-slot scalars) replicate per element instead of
+	 * as dozens of separately compared properties.
+	 */
+	int32 ArraySize = 0;
+
+	bool IsArray() const { return ArraySize > 0; }
+
+	bool IsFlag() const { return AttributeType == TEXT("flag"); }
+
+	/** True if this attribute is an FGameplayAttributeData property that GameplayEffect modifiers can target. */
+	bool IsGameplayAttribute() const { return !IsArray() && !IsFlag(); }
+};
+
+/**
+ * Collection of attribute definitions that forms the schema for a single AttributeSet.
+ * 
+ * WHY: Provides a cohesive structure for managing related attributes as a group,
+ * enabling modular generation and replication of complex attribute sets.
+ */
+struct GASXCODEGEN_API FGasXAttributeSetSchema
+{
+	/** Name of the generated AttributeSet class (e.g., "GasXCharacterAttributes") */
+	FString AttributeSetClassName;
+
+	/** Module in which to generate the class (e.g., "GasXRuntime") */
+	FString TargetModule = TEXT("GasXRuntime");
+
+	/** Directory relative to module (e.g., "Public/Attributes") */
+	FString TargetDirectory = TEXT("Public/Attributes");
+
+	/** List of attribute definitions that comprise this schema */
+	TArray<FGasXAttributeDefinition> Attributes;
+
+	/** If true, generator will emit a native UGE_Init<Set> GameplayEffect class alongside the AttributeSet */
+	bool bGenerateInitGameplayEffect = true;
+
+	/** If true, generator will create a data-driven metadata DataTable */
+	bool bGenerateMetadataTable = true;
+
+	/** If true, generated setters and effect executions append attribute changes to FGasXAttributeJournal */
+	bool bJournal = false;
+
+	/** Description of this attribute set (for documentation) */
+	FString Description;
+
+	/** If true, this schema is a shared attribute fragment that is only included by other schemas, never generated on its own */
+	bool bIsFragment = false;
+
+	/** Schema file (relative to this one) whose attributes this schema inherits. Empty once resolved. */
+	FString Extends;
+
+	/** Fragment files (relative to this one) whose attributes are merged in after Extends. Empty once resolved. */
+	TArray<FString> Includes;
+};
@@ -0,0 +1,196 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GasXAttributeDefinition.h"
+
+/**
+ * Emits C++ AttributeSet source from FGasXAttributeSetSchema definitions and merges it into existing files.
+ *
+ * WHY: Text generation needs nothing beyond Core, so it runs both inside the editor (through
+ * FGasXAttributeSetGenerator) and in the standalone GasXGen program without booting the engine.
+ */
+class GASXCODEGEN_API FGasXAttributeSetEmitter
+{
+public:
+	/** Flag attributes a set can hold; must match UGasXFlagAttributeSet::MaxFlags (checked in GasXEditor). */
+	static constexpr int32 MaxFlags = 64;
+
+	/** Elements an array attribute can hold; must match FGasXAttributeArray::MaxElements (checked in GasXEditor). */
+	static constexpr int32 MaxArrayElements = 256;
+
+	/**
+	 * Validate the schema, then generate and merge the .h and .cpp files, writing only those whose content changed.
+	 *
+	 * @param Schema The attribute definition schema to code-gen from
+	 * @param OutputHeaderPath Full path where the .h file should be written
+	 * @param OutputSourcePath Full path where the .cpp file should be written
+	 * @param OutError What went wrong if generation failed
+	 * @return true if both files are up to date on disk; false on error
+	 */
+	bool GenerateFiles(
+		const FGasXAttributeSetSchema& Schema,
+		const FString& OutputHeaderPath,
+		const FString& OutputSourcePath,
+		FString& OutError) const;
+
+	/**
+	 * Compute what GenerateFiles would write without touching disk.
+	 * WHY: Lets batch runs verify that checked-in generated code is up to date with its schema.
+	 *
+	 * @param Schema The attribute definition schema
+	 * @param OutputHeaderPath Full path of the .h file that would be written
+	 * @param OutputSourcePath Full path of the .cpp file that would be written
+	 * @param OutOutOfDateFiles Receives every output path whose merged content differs from disk
+	 * @param OutError Validation error if the schema cannot be generated
+	 * @return true if the schema is valid and the comparison ran; false on error
+	 */
+	bool CollectOutOfDateFiles(
+		const FGasXAttributeSetSchema& Schema,
+		const FString& OutputHeaderPath,
+		const FString& OutputSourcePath,
+		TArray<FString>& OutOutOfDateFiles,
+		FString& OutError) const;
+
+	/**
+	 * Resolve the header and source paths a schema generates into, following the plugin's module layout.
+	 *
+	 * @param Schema The attribute definition schema
+	 * @param PluginDir Root directory of the GasX plugin
+	 * @param OutHeaderPath Full path of the generated .h file
+	 * @param OutSourcePath Full path of the generated .cpp file
+	 */
+	static void ResolveOutputPaths(const FGasXAttributeSetSchema& Schema, const FString& PluginDir, FString& OutHeaderPath, FString& OutSourcePath);
+
+	/**
+	 * Validate that a schema is well-formed before generation.
+	 * WHY: Fail fast on empty names, duplicates, invalid identifiers, or reserved keywords.
+	 */
+	bool ValidateSchema(const FGasXAttributeSetSchema& Schema, FString& OutError) const;
+
+	/**
+	 * Generate the header file content for an AttributeSet.
+	 */
+	FString GenerateHeaderContent(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Generate the implementation file content for an AttributeSet.
+	 */
+	FString GenerateSourceContent(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Merge new generated content with existing file while preserving custom code outside guarded regions.
+	 * WHY: Allows incremental regeneration without losing developer customizations.
+	 */
+	FString MergeWithExistingFile(const FString& FilePath, const FString& NewGeneratedContent) const;
+
+	/**
+	 * Replace guarded regions inside the existing file with the freshly generated versions.
+	 * WHY: Preserve developer code outside guarded regions while still updating generated blocks.
+	 */
+	FString ReplaceGuardedRegions(const FString& ExistingContent, const FString& NewContent) const;
+
+private:
+	/**
+	 * Generate the statements that put every attribute at its schema default.
+	 * WHY: The constructor and ResetToDefaults() must agree on the defaults; bReset picks the reset form for arrays and flags.
+	 */
+	FString GenerateDefaultAssignments(const FGasXAttributeSetSchema& Schema, bool bReset) const;
+
+	/**
+	 * Generate ResetToDefaults(), restoring compiled defaults in place for respawn without re-instantiating the set.
+	 */
+	FString GenerateResetToDefaults(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Generate Pre/PostGameplayEffectExecute overrides that journal effect-driven changes for "bJournal" schemas.
+	 */
+	FString GenerateJournalHooks(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Generate a single attribute property declaration with replication setup.
+	 */
+	FString GenerateAttributeProperty(const FGasXAttributeDefinition& Attribute) const;
+
+	/**
+	 * Generate OnRep function declaration for a single attribute.
+	 */
+	FString GenerateOnRepDeclaration(const FGasXAttributeDefinition& Attribute) const;
+
+	/**
+	 * Generate accessor macros for a single attribute. bJournal swaps in the journaling setter.
+	 */
+	FString GenerateAccessors(const FGasXAttributeDefinition& Attribute, const FString& ClassName, bool bJournal) const;
+
+	/**
+	 * Generate OnRep implementation that broadcasts the attribute change.
+	 */
+	FString GenerateOnRepImplementation(const FGasXAttributeDefinition& Attribute, const FString& ClassName) const;
+
+	/**
+	 * Generate replication setup for all attributes.
+	 */
+	FString GenerateReplicationSetup(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Generate the native UGE_Init<Set> class declaration, emitted after the AttributeSet in the header.
+	 * WHY: A native init effect loads as a CDO with modifiers already bound; no Blueprint compile or manual fix-up.
+	 */
+	FString GenerateInitEffectDeclaration(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Generate the UGE_Init<Set> constructor that adds one Override modifier per attribute.
+	 */
+	FString GenerateInitEffectImplementation(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Generate per-attribute SetByCaller tags and the static registration that feeds UGasXUniversalInitEffect.
+	 * WHY: Lets one init spec cover every generated set on an actor instead of one effect per set.
+	 */
+	FString GenerateInitAttributeRegistration(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Generate the flag masks, Is/Set accessors and GetFlagNames() override for flag attributes.
+	 * WHY: Flags pack into UGasXFlagAttributeSet::FlagBits, one bit each in schema order, instead of a property per flag.
+	 */
+	FString GenerateFlagDeclarations(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Generate the GetFlagNames() table mapping each bit back to its schema name.
+	 */
+	FString GenerateFlagImplementation(const FGasXAttributeSetSchema& Schema) const;
+
+	/**
+	 * Ensure the output directory exists.
+	 */
+	bool EnsureOutputDirectory(const FString& DirectoryPath) const;
+
+	/**
+	 * Check if a name is a reserved C++ keyword.
+	 */
+	bool IsReservedKeyword(const FString& Name) const;
+
+	/**
+	 * Check if a name is a valid C++ identifier.
+	 */
+	bool IsValidIdentifier(const FString& Name) const;
+
+	/**
+	 * Add #include lines from the new content that the existing file lacks.
+	 * WHY: Includes live outside guarded regions, but newer generated regions may depend on them.
+	 */
+	void MergeIncludeLines(FString& InOutContent, const FString& NewContent) const;
+
+	/**
+	 * Rewrite the base class of generated class declarations whose base changed.
+	 * WHY: Class declaration lines sit outside the guarded regions, but adding flags switches the base to UGasXFlagAttributeSet.
+	 */
+	void MergeBaseClasses(FString& InOutContent, const FString& NewContent) const;
+
+	/**
+	 * Write content to disk only when it differs from what is already there.
+	 * WHY: Unchanged outputs keep their timestamps, so UBT and Live Coding skip recompiling them on incremental regeneration.
+	 */
+	bool WriteFileIfChanged(const FString& FilePath, const FString& Content) const;
+};
@@ -0,0 +1,20 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Process exit codes shared by the GasXGenerate commandlet and the standalone GasXGen program. */
+namespace EGasXGenerateExitCode
+{
+	enum Type : int32
+	{
+		Success = 0,
+		/** One or more schemas failed to parse, validate or generate. */
+		GenerationFailed = 1,
+		/** -Verify found generated files that differ from their schema. */
+		OutOfDate = 2,
+		/** Missing arguments or the glob matched no schema files. */
+		InvalidArguments = 3,
+	};
+}
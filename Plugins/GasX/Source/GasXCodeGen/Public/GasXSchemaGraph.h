@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GasXAttributeDefinition.h"
+#include "GasXSchemaParser.h"
+
+/**
+ * Loads schema files together with everything they Extend or Include and flattens each
+ * into a self-contained FGasXAttributeSetSchema.
+ *
+ * WHY: Shared attribute fragments (Health, MaxHealth, Mana, ...) are declared once and reused
+ * across sets. Resolution happens once per graph build; the generator, DataTable emitter and
+ * schema validation only ever see the flattened result.
+ *
+ * Resolution order: attributes of the Extends parent, then each Include in order, then the
+ * schema's own attributes. A later attribute with the same name (case-insensitive) replaces the
+ * earlier definition in place, so overrides keep the inherited declaration order.
+ *
+ * The graph keeps parse results and resolved schemas between calls. After files change, call
+ * Invalidate() followed by AddSchemas() to reload only what changed, and GetDependentSchemas()
+ * to find the generatable schemas that must be regenerated.
+ */
+class GASXCODEGEN_API FGasXSchemaGraph
+{
+public:
+	/**
+	 * Load the given schema files plus every file they reference, then resolve them.
+	 * Already loaded files are not parsed again.
+	 *
+	 * @param SchemaFiles Absolute paths to schema files
+	 * @param CacheDirectory Forwarded to FGasXSchemaParser::LoadSchemas; empty disables the parse cache
+	 */
+	void AddSchemas(const TArray<FString>& SchemaFiles, const FString& CacheDirectory);
+
+	/** Forget the given files and every resolved schema that depends on them. */
+	void Invalidate(const TArray<FString>& ChangedFiles);
+
+	/** Flattened schema for a file, or nullptr if it failed to load or resolve. */
+	const FGasXAttributeSetSchema* GetResolvedSchema(const FString& SchemaFile) const;
+
+	/** Parse and resolution diagnostics for a file (including its references). */
+	TArray<FGasXSchemaDiagnostic> GetDiagnostics(const FString& SchemaFile) const;
+
+	/** True if the file was loaded from the parse cache. */
+	bool WasLoadedFromCache(const FString& SchemaFile) const;
+
+	/**
+	 * Non-fragment schemas affected by a change to any of the given files: the files themselves
+	 * plus everything that transitively Extends or Includes them.
+	 */
+	TArray<FString> GetDependentSchemas(const TArray<FString>& ChangedFiles) const;
+
+	/** Every loaded, non-fragment schema file. */
+	TArray<FString> GetGeneratableSchemas() const;
+
+	/** Normalize a schema path so lookups are stable regardless of how it was spelled. */
+	static FString NormalizePath(const FString& SchemaFile);
+
+private:
+	struct FNode
+	{
+		FGasXSchemaParseResult ParseResult;
+
+		/** Normalized paths of the Extends parent and Includes, in resolution order. */
+		TArray<FString> References;
+
+		bool bResolved = false;
+		bool bResolveSucceeded = false;
+		FGasXAttributeSetSchema Resolved;
+		TArray<FGasXSchemaDiagnostic> ResolveDiagnostics;
+	};
+
+	/** Resolve one node, recursing into its references. Visiting tracks the current chain for cycle detection. */
+	bool Resolve(const FString& Path, TArray<FString>& Visiting);
+
+	void ResolveAll();
+
+	/** The given files plus every node (fragments included) that transitively references them. */
+	TSet<FString> CollectAffected(const TArray<FString>& ChangedFiles) const;
+
+	static void MergeAttributes(TArray<FGasXAttributeDefinition>& Into, const TArray<FGasXAttributeDefinition>& From);
+
+	static FGasXSchemaDiagnostic MakeDiagnostic(const FString& File, const FString& Message);
+
+	TMap<FString, FNode> Nodes;
+};
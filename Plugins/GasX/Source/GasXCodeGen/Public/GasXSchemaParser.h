@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GasXAttributeDefinition.h"
+
+/**
+ * A single problem found while parsing a schema, located at file:line:column.
+ */
+struct GASXCODEGEN_API FGasXSchemaDiagnostic
+{
+	FString File;
+	int32 Line = 0;
+	int32 Column = 0;
+	FString Message;
+	bool bIsError = true;
+
+	/** Formats as "File(Line:Column): error: Message" so IDEs and build logs can jump to the location. */
+	FString ToString() const;
+};
+
+/**
+ * Outcome of parsing one schema file.
+ */
+struct GASXCODEGEN_API FGasXSchemaParseResult
+{
+	FString FilePath;
+	FGasXAttributeSetSchema Schema;
+	TArray<FGasXSchemaDiagnostic> Diagnostics;
+	bool bSuccess = false;
+
+	/** True if the schema was loaded from the on-disk parse cache instead of being parsed. */
+	bool bFromCache = false;
+
+	/** All error diagnostics joined by newlines. */
+	FString GetErrorString() const;
+};
+
+/**
+ * Utility for parsing JSON schema files into FGasXAttributeSetSchema structs.
+ *
+ * WHY: Provides editor-only JSON parsing to load schema definitions from disk.
+ * Runtime modules must never depend on this.
+ *
+ * Schemas are read with a streaming JSON reader so every error can be reported with its
+ * file:line:column. Required fields, field types and the declared SchemaVersion are validated;
+ * unknown fields are reported as warnings so typos do not silently fall back to defaults.
+ *
+ * Successfully parsed schemas are cached in a caller-supplied directory (normally Saved/GasX/SchemaCache,
+ * see GetCacheDirectory()) keyed by a hash of the file content, so unchanged schemas skip parsing
+ * entirely on later batch and watch runs.
+ */
+class GASXCODEGEN_API FGasXSchemaParser
+{
+public:
+	/** Highest SchemaVersion this parser understands. */
+	static constexpr int32 CurrentSchemaVersion = 1;
+
+	/**
+	 * Load and parse a JSON schema file.
+	 *
+	 * @param JsonFilePath Absolute path to the .json schema file
+	 * @param OutSchema The parsed schema structure
+	 * @param OutError Error message if parsing fails
+	 * @param CacheDirectory Directory holding cached parse results; if empty, always parse and do not touch the cache
+	 * @return true if parsing succeeded, false otherwise
+	 */
+	static bool LoadSchemaFromJson(const FString& JsonFilePath, FGasXAttributeSetSchema& OutSchema, FString& OutError, const FString& CacheDirectory);
+
+	/**
+	 * Load one schema file, consulting the parse cache first.
+	 *
+	 * @param JsonFilePath Absolute path to the .json schema file
+	 * @param CacheDirectory Directory holding cached parse results; if empty, always parse and do not touch the cache
+	 */
+	static FGasXSchemaParseResult LoadSchema(const FString& JsonFilePath, const FString& CacheDirectory);
+
+	/**
+	 * Load many schema files concurrently on worker threads.
+	 * WHY: Batch and watch runs parse dozens of schemas; file IO and parsing are independent per file.
+	 *
+	 * @param JsonFilePaths Absolute paths to the .json schema files
+	 * @param CacheDirectory Directory holding cached parse results; if empty, always parse and do not touch the cache
+	 * @return One result per input path, in the same order
+	 */
+	static TArray<FGasXSchemaParseResult> LoadSchemas(const TArray<FString>& JsonFilePaths, const FString& CacheDirectory);
+
+	/**
+	 * Parse schema JSON text.
+	 *
+	 * @param JsonString The schema JSON
+	 * @param SourceName File name used in diagnostics
+	 * @param OutSchema The parsed schema structure
+	 * @param OutDiagnostics Errors and warnings with their locations
+	 * @return true if no errors were reported
+	 */
+	static bool ParseSchemaString(const FString& JsonString, const FString& SourceName, FGasXAttributeSetSchema& OutSchema, TArray<FGasXSchemaDiagnostic>& OutDiagnostics);
+
+	/**
+	 * Standard parse cache directory under a project's Saved directory.
+	 * WHY: FPaths::ProjectSavedDir() is the engine's program Saved directory inside GasXGen, so the caller supplies the root.
+	 *
+	 * @param SavedDir The project's Saved directory: FPaths::ProjectSavedDir() in the editor, <ProjectDir>/Saved in GasXGen
+	 */
+	static FString GetCacheDirectory(const FString& SavedDir);
+
+	/**
+	 * Expand a schema file glob into absolute, sorted file paths.
+	 *
+	 * @param Glob File glob; a trailing "**" directory searches recursively
+	 * @param BaseDir Directory a relative glob is resolved against
+	 */
+	static TArray<FString> FindSchemaFiles(const FString& Glob, const FString& BaseDir);
+
+private:
+	static FString GetCacheFilePath(const FString& CacheDirectory, uint64 ContentHash);
+	static bool LoadFromCache(const FString& CacheDirectory, uint64 ContentHash, FGasXAttributeSetSchema& OutSchema);
+	static void SaveToCache(const FString& CacheDirectory, uint64 ContentHash, const FGasXAttributeSetSchema& Schema);
+};
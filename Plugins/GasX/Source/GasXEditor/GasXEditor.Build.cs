@@ -12,13 +12,14 @@ public class GasXEditor : ModuleRules
             "GameplayAbilities", "GameplayTags",
             "GameFeatures", "ModularGameplay",
             "UnrealEd", "AssetTools", "Slate", "SlateCore",
-            "GasXRuntime"
+            "GasXRuntime", "GasXCodeGen"
         });
 
         PrivateDependencyModuleNames.AddRange(new[]
         {
             "EditorFramework", "Kismet", "InputCore",
-            "Json", "JsonUtilities"
+            "Json", "JsonUtilities",
+            "DirectoryWatcher"
         });
     }
 }
@@ -1,73 +1,43 @@
 // Copyright Epic Games, Inc.
 
 #include "GasXAttributeSetGenerator.h"
+#include "GasXAttributeArray.h"
+#include "GasXFlagAttributeSet.h"
 #include "Logging/LogMacros.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "HAL/PlatformFileManager.h"
 
 #if WITH_EDITOR
 #include "AssetToolsModule.h"
 #include "IAssetTools.h"
 #include "Factories/DataTableFactory.h"
-#include "Factories/BlueprintFactory.h"
 #include "Engine/DataTable.h"
-#include "GameplayEffect.h"
+#include "Engine/CurveTable.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/Package.h"
 #include "GasXAttributeMetadata.h"
-#include "UObject/SavePackage.h"
-#include "Kismet2/KismetEditorUtilities.h"
+#include "FileHelpers.h"
 #endif
 
 DEFINE_LOG_CATEGORY_STATIC(LogGasXAttributeSetGenerator, Log, All);
 
+// WHY: The emitter cannot see runtime types, so it keeps its own copy of the limits generated code must respect
+static_assert(FGasXAttributeSetEmitter::MaxFlags == UGasXFlagAttributeSet::MaxFlags, "Emitter flag limit is out of sync with UGasXFlagAttributeSet");
+static_assert(FGasXAttributeSetEmitter::MaxArrayElements == FGasXAttributeArray::MaxElements, "Emitter array limit is out of sync with FGasXAttributeArray");
+
 bool FGasXAttributeSetGenerator::GenerateAttributeSet(
 	const FGasXAttributeSetSchema &Schema,
 	const FString &OutputHeaderPath,
 	const FString &OutputSourcePath)
 {
-	FString ValidationError;
-	if (!ValidateSchema(Schema, ValidationError))
-	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Schema validation failed: %s"), *ValidationError);
-		return false;
-	}
-
-	if (!EnsureOutputDirectory(FPaths::GetPath(OutputHeaderPath)))
-	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Failed to create output directory for header: %s"), *OutputHeaderPath);
-		return false;
-	}
-
-	if (!EnsureOutputDirectory(FPaths::GetPath(OutputSourcePath)))
-	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Failed to create output directory for source: %s"), *OutputSourcePath);
-		return false;
-	}
-
-	FString HeaderContent = GenerateHeaderContent(Schema);
-	FString SourceContent = GenerateSourceContent(Schema);
-
-	// WHY: Merge with existing files to preserve custom code outside guarded regions
-	FString FinalHeaderContent = MergeWithExistingFile(OutputHeaderPath, HeaderContent);
-	FString FinalSourceContent = MergeWithExistingFile(OutputSourcePath, SourceContent);
-
-	if (!FFileHelper::SaveStringToFile(FinalHeaderContent, *OutputHeaderPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	FString Error;
+	if (!Emitter.GenerateFiles(Schema, OutputHeaderPath, OutputSourcePath, Error))
 	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Failed to write header file: %s"), *OutputHeaderPath);
+		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("%s"), *Error);
 		return false;
 	}
 
-	if (!FFileHelper::SaveStringToFile(FinalSourceContent, *OutputSourcePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
-	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Failed to write source file: %s"), *OutputSourcePath);
-		return false;
-	}
-
-	UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("Successfully generated AttributeSet: %s"), *Schema.AttributeSetClassName);
-	UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("  Header: %s"), *OutputHeaderPath);
-	UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("  Source: %s"), *OutputSourcePath);
-
-	// WHY: Optionally generate DataTable and Init GameplayEffect assets based on schema flags
+	// WHY: Optionally generate the metadata DataTable asset based on schema flags
 	bool bAllSucceeded = true;
 
 	if (Schema.bGenerateMetadataTable)
@@ -82,576 +52,350 @@ bool FGasXAttributeSetGenerator::GenerateAttributeSet(
 		}
 	}
 
-	if (Schema.bGenerateInitGameplayEffect)
+	const bool bHasLevelCurves = Schema.Attributes.ContainsByPredicate([](const FGasXAttributeDefinition &Attr) { return Attr.LevelCurve.Num() > 0; });
+	if (Schema.bGenerateMetadataTable && bHasLevelCurves)
 	{
-		// WHY: Construct asset path from schema: /Game/Generated/Attributes/GE_Init[ClassName]
-		FString InitGEPath = FString::Printf(TEXT("/Game/Generated/Attributes/GE_Init%s"), *Schema.AttributeSetClassName);
+		// WHY: Construct asset path from schema: /Game/Generated/Attributes/[ClassName]Curves
+		FString CurveTablePath = FString::Printf(TEXT("/Game/Generated/Attributes/%sCurves"), *Schema.AttributeSetClassName);
 
-		if (!GenerateInitGameplayEffect(Schema, InitGEPath))
+		if (!GenerateLevelCurveTable(Schema, CurveTablePath))
 		{
-			UE_LOG(LogGasXAttributeSetGenerator, Warning, TEXT("Failed to generate Init GameplayEffect for %s"), *Schema.AttributeSetClassName);
+			UE_LOG(LogGasXAttributeSetGenerator, Warning, TEXT("Failed to generate level CurveTable for %s"), *Schema.AttributeSetClassName);
 			bAllSucceeded = false;
 		}
 	}
 
+	if (!bDeferPackageSaves && !SavePendingPackages())
+	{
+		bAllSucceeded = false;
+	}
+
 	return bAllSucceeded;
 }
 
-bool FGasXAttributeSetGenerator::ValidateSchema(const FGasXAttributeSetSchema &Schema, FString &OutError) const
+bool FGasXAttributeSetGenerator::CollectOutOfDateFiles(
+	const FGasXAttributeSetSchema &Schema,
+	const FString &OutputHeaderPath,
+	const FString &OutputSourcePath,
+	TArray<FString> &OutOutOfDateFiles,
+	FString &OutError) const
 {
-	if (Schema.AttributeSetClassName.IsEmpty())
-	{
-		OutError = TEXT("AttributeSetClassName cannot be empty");
-		return false;
-	}
+	return Emitter.CollectOutOfDateFiles(Schema, OutputHeaderPath, OutputSourcePath, OutOutOfDateFiles, OutError);
+}
 
-	if (!IsValidIdentifier(Schema.AttributeSetClassName))
-	{
-		OutError = FString::Printf(TEXT("AttributeSetClassName '%s' is not a valid C++ identifier"), *Schema.AttributeSetClassName);
-		return false;
-	}
+void FGasXAttributeSetGenerator::ResolveOutputPaths(const FGasXAttributeSetSchema &Schema, FString &OutHeaderPath, FString &OutSourcePath)
+{
+	FGasXAttributeSetEmitter::ResolveOutputPaths(Schema, FPaths::ProjectPluginsDir() / TEXT("GasX"), OutHeaderPath, OutSourcePath);
+}
 
-	if (Schema.Attributes.Num() == 0)
+bool FGasXAttributeSetGenerator::GenerateMetadataTable(const FGasXAttributeSetSchema &Schema, const FString &OutputAssetPath)
+{
+	// WHY: Keep a UDataTable with FGasXAttributeMetadataRow structure in sync with the schema while preserving designer edits
+	// NOTE: This must run in editor context with AssetTools available
+
+#if WITH_EDITOR
+	// WHY: Parse the output path into package and asset names
+	// Example: "/Game/Generated/Attributes/PlayerCoreMetadata" → Package="/Game/Generated/Attributes", Asset="PlayerCoreMetadata"
+	FString PackagePath, AssetName;
+	OutputAssetPath.Split(TEXT("/"), &PackagePath, &AssetName, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	if (PackagePath.IsEmpty() || AssetName.IsEmpty())
 	{
-		OutError = TEXT("Schema must contain at least one attribute");
+		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Invalid OutputAssetPath format: %s (expected /Game/Path/AssetName)"), *OutputAssetPath);
 		return false;
 	}
 
-	TSet<FString> SeenNames;
-	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	// WHY: Update the existing table in place. Recreating it would invalidate references, discard designer edits
+	// and dirty cooked content even when nothing changed.
+	UDataTable *DataTable = nullptr;
+	if (FPackageName::DoesPackageExist(OutputAssetPath))
 	{
-		if (Attr.AttributeName.IsEmpty())
+		DataTable = LoadObject<UDataTable>(nullptr, *FString::Printf(TEXT("%s.%s"), *OutputAssetPath, *AssetName), nullptr, LOAD_NoWarn);
+		if (!DataTable)
 		{
-			OutError = TEXT("Attribute name cannot be empty");
+			UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Asset exists but is not a DataTable: %s"), *OutputAssetPath);
 			return false;
 		}
 
-		FString LowerName = Attr.AttributeName.ToLower();
-		if (SeenNames.Contains(LowerName))
+		if (DataTable->GetRowStruct() != FGasXAttributeMetadataRow::StaticStruct())
 		{
-			OutError = FString::Printf(TEXT("Duplicate attribute name (case-insensitive): %s"), *Attr.AttributeName);
+			UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("DataTable %s does not use FGasXAttributeMetadataRow; refusing to overwrite it"), *OutputAssetPath);
 			return false;
 		}
-		SeenNames.Add(LowerName);
+	}
+	else
+	{
+		// WHY: AssetTools provides the CreateAsset() API for programmatic asset generation
+		IAssetTools &AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
 
-		if (!IsValidIdentifier(Attr.AttributeName))
-		{
-			OutError = FString::Printf(TEXT("Attribute name '%s' is not a valid C++ identifier"), *Attr.AttributeName);
-			return false;
-		}
+		// WHY: DataTableFactory is required to create UDataTable instances
+		UDataTableFactory *Factory = NewObject<UDataTableFactory>();
+		Factory->Struct = FGasXAttributeMetadataRow::StaticStruct();
 
-		if (IsReservedKeyword(Attr.AttributeName))
-		{
-			OutError = FString::Printf(TEXT("Attribute name '%s' is a reserved C++ keyword"), *Attr.AttributeName);
-			return false;
-		}
+		DataTable = Cast<UDataTable>(AssetTools.CreateAsset(
+			AssetName,
+			PackagePath,
+			UDataTable::StaticClass(),
+			Factory));
 
-		if (Attr.AttributeType != TEXT("float") && Attr.AttributeType != TEXT("int32"))
+		if (!DataTable)
 		{
-			OutError = FString::Printf(TEXT("Attribute type '%s' not supported in MVP (use 'float' or 'int32')"), *Attr.AttributeType);
+			UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Failed to create DataTable asset: %s"), *OutputAssetPath);
 			return false;
 		}
 	}
 
-	return true;
-}
-
-FString FGasXAttributeSetGenerator::GenerateHeaderContent(const FGasXAttributeSetSchema &Schema) const
-{
-	FString Header = TEXT("// Copyright Epic Games, Inc.\n");
-	Header += TEXT("// AUTO-GENERATED by GasXAttributeSetGenerator - DO NOT EDIT MANUALLY\n\n");
-	Header += TEXT("#pragma once\n\n");
-	Header += TEXT("#include \"CoreMinimal.h\"\n");
-	Header += TEXT("#include \"AttributeSet.h\"\n");
-	Header += TEXT("#include \"AbilitySystemComponent.h\"\n");
-	Header += FString::Printf(TEXT("#include \"%s.generated.h\"\n\n"), *Schema.AttributeSetClassName);
-
-	Header += TEXT("/**\n");
-	Header += FString::Printf(TEXT(" * Generated AttributeSet: %s\n"), *Schema.AttributeSetClassName);
-	if (!Schema.Description.IsEmpty())
-	{
-		Header += FString::Printf(TEXT(" * %s\n"), *Schema.Description);
-	}
-	Header += TEXT(" */\n");
-	Header += TEXT("UCLASS()\n");
-	Header += FString::Printf(TEXT("class %s_API U%s : public UAttributeSet\n"), *Schema.TargetModule.ToUpper(), *Schema.AttributeSetClassName);
-	Header += TEXT("{\n");
-	Header += TEXT("\tGENERATED_BODY()\n\n");
-	Header += TEXT("public:\n");
-	Header += FString::Printf(TEXT("\tU%s();\n\n"), *Schema.AttributeSetClassName);
-
-	// Generate attribute properties
-	Header += TEXT("\t//GEN-BEGIN: Attribute Properties\n");
-	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
-	{
-		Header += GenerateAttributeProperty(Attr);
-	}
-	Header += TEXT("\t//GEN-END: Attribute Properties\n\n");
-
-	// Generate accessors
-	Header += TEXT("\t//GEN-BEGIN: Attribute Accessors\n");
-	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
-	{
-		Header += GenerateAccessors(Attr, Schema.AttributeSetClassName);
-	}
-	Header += TEXT("\t//GEN-END: Attribute Accessors\n\n");
-
-	// Generate OnRep declarations
-	Header += TEXT("\t//GEN-BEGIN: OnRep Functions\n");
-	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	bool bModified = false;
+	auto BeginModify = [DataTable, &bModified]()
 	{
-		if (Attr.bReplicates && Attr.bRepNotify)
+		if (!bModified)
 		{
-			Header += GenerateOnRepDeclaration(Attr);
+			DataTable->Modify();
+			bModified = true;
 		}
-	}
-	Header += TEXT("\t//GEN-END: OnRep Functions\n\n");
-
-	Header += TEXT("\tvirtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;\n");
-	Header += TEXT("};\n");
-
-	return Header;
-}
+	};
 
-FString FGasXAttributeSetGenerator::GenerateSourceContent(const FGasXAttributeSetSchema &Schema) const
-{
-	FString Source = TEXT("// Copyright Epic Games, Inc.\n");
-	Source += TEXT("// AUTO-GENERATED by GasXAttributeSetGenerator - DO NOT EDIT MANUALLY\n\n");
-	Source += FString::Printf(TEXT("#include \"Attributes/%s.h\"\n"), *Schema.AttributeSetClassName);
-	Source += TEXT("#include \"Net/UnrealNetwork.h\"\n\n");
-
-	// Constructor
-	Source += FString::Printf(TEXT("U%s::U%s()\n"), *Schema.AttributeSetClassName, *Schema.AttributeSetClassName);
-	Source += TEXT("{\n");
-	Source += TEXT("\t//GEN-BEGIN: Constructor Initialization\n");
-	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
-	{
-		Source += FString::Printf(TEXT("\t%s.SetBaseValue(%.2ff);\n"), *Attr.AttributeName, Attr.DefaultValue);
-		Source += FString::Printf(TEXT("\t%s.SetCurrentValue(%.2ff);\n"), *Attr.AttributeName, Attr.DefaultValue);
-	}
-	Source += TEXT("\t//GEN-END: Constructor Initialization\n");
-	Source += TEXT("}\n\n");
+	int32 NumAdded = 0;
+	int32 NumUpdated = 0;
+	int32 NumRemoved = 0;
 
-	// OnRep implementations
-	Source += TEXT("//GEN-BEGIN: OnRep Implementations\n");
+	TSet<FName> SchemaRowNames;
 	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
 	{
-		if (Attr.bReplicates && Attr.bRepNotify)
+		// NOTE: Array and flag defaults are compiled into the set constructor; a row would suggest a designer override that nothing reads
+		if (!Attr.IsGameplayAttribute())
 		{
-			Source += GenerateOnRepImplementation(Attr, Schema.AttributeSetClassName);
+			continue;
 		}
-	}
-	Source += TEXT("//GEN-END: OnRep Implementations\n\n");
 
-	// Replication setup
-	Source += GenerateReplicationSetup(Schema);
-
-	return Source;
-}
+		const FName RowName = FName(*Attr.AttributeName);
+		SchemaRowNames.Add(RowName);
 
-FString FGasXAttributeSetGenerator::GenerateAttributeProperty(const FGasXAttributeDefinition &Attribute) const
-{
-	FString Property;
-	if (!Attribute.Description.IsEmpty())
-	{
-		Property += FString::Printf(TEXT("\t/** %s */\n"), *Attribute.Description);
-	}
+		FGasXAttributeMetadataRow RowData;
+		RowData.BaseValue = Attr.DefaultValue;
+		RowData.MinValue = Attr.MinValue;
+		RowData.MaxValue = Attr.MaxValue;
+		RowData.Description = Attr.Description.IsEmpty()
+								  ? FString::Printf(TEXT("Metadata for %s attribute"), *Attr.AttributeName)
+								  : Attr.Description;
 
-	Property += TEXT("\tUPROPERTY(BlueprintReadOnly, Category=\"Attributes\"");
-	if (Attribute.bReplicates && Attribute.bRepNotify)
-	{
-		Property += FString::Printf(TEXT(", ReplicatedUsing=OnRep_%s"), *Attribute.AttributeName);
-	}
-	Property += TEXT(")\n");
-	Property += FString::Printf(TEXT("\tFGameplayAttributeData %s;\n\n"), *Attribute.AttributeName);
-
-	return Property;
-}
-
-FString FGasXAttributeSetGenerator::GenerateOnRepDeclaration(const FGasXAttributeDefinition &Attribute) const
-{
-	FString Decl = TEXT("\tUFUNCTION()\n");
-	Decl += FString::Printf(TEXT("\tvirtual void OnRep_%s(const FGameplayAttributeData& OldValue);\n\n"), *Attribute.AttributeName);
-	return Decl;
-}
-
-FString FGasXAttributeSetGenerator::GenerateAccessors(const FGasXAttributeDefinition &Attribute, const FString &ClassName) const
-{
-	FString Accessors;
-	Accessors += FString::Printf(TEXT("\tGAMEPLAYATTRIBUTE_PROPERTY_GETTER(U%s, %s)\n"), *ClassName, *Attribute.AttributeName);
-	Accessors += FString::Printf(TEXT("\tGAMEPLAYATTRIBUTE_VALUE_GETTER(%s)\n"), *Attribute.AttributeName);
-	Accessors += FString::Printf(TEXT("\tGAMEPLAYATTRIBUTE_VALUE_SETTER(%s)\n"), *Attribute.AttributeName);
-	Accessors += FString::Printf(TEXT("\tGAMEPLAYATTRIBUTE_VALUE_INITTER(%s)\n\n"), *Attribute.AttributeName);
-	return Accessors;
-}
-
-FString FGasXAttributeSetGenerator::GenerateOnRepImplementation(const FGasXAttributeDefinition &Attribute, const FString &ClassName) const
-{
-	FString Impl;
-	Impl += FString::Printf(TEXT("void U%s::OnRep_%s(const FGameplayAttributeData& OldValue)\n"), *ClassName, *Attribute.AttributeName);
-	Impl += TEXT("{\n");
-	Impl += FString::Printf(TEXT("\tGAMEPLAYATTRIBUTE_REPNOTIFY(U%s, %s, OldValue);\n"), *ClassName, *Attribute.AttributeName);
-	Impl += TEXT("}\n\n");
-	return Impl;
-}
-
-FString FGasXAttributeSetGenerator::GenerateReplicationSetup(const FGasXAttributeSetSchema &Schema) const
-{
-	FString Repl;
-	Repl += FString::Printf(TEXT("void U%s::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const\n"), *Schema.AttributeSetClassName);
-	Repl += TEXT("{\n");
-	Repl += TEXT("\tSuper::GetLifetimeReplicatedProps(OutLifetimeProps);\n\n");
-	Repl += TEXT("\t//GEN-BEGIN: Replication Setup\n");
-	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
-	{
-		if (Attr.bReplicates)
+		FGasXAttributeMetadataRow *ExistingRow = DataTable->FindRow<FGasXAttributeMetadataRow>(RowName, TEXT("GasXGenerator"), /*bWarnIfRowMissing*/ false);
+		if (!ExistingRow)
 		{
-			Repl += FString::Printf(TEXT("\tDOREPLIFETIME_CONDITION_NOTIFY(U%s, %s, COND_None, REPNOTIFY_Always);\n"),
-									*Schema.AttributeSetClassName, *Attr.AttributeName);
+			BeginModify();
+			RowData.RecordGeneratedSnapshot();
+			DataTable->AddRow(RowName, RowData);
+			++NumAdded;
+			continue;
 		}
-	}
-	Repl += TEXT("\t//GEN-END: Replication Setup\n");
-	Repl += TEXT("}\n");
-	return Repl;
-}
-
-bool FGasXAttributeSetGenerator::EnsureOutputDirectory(const FString &DirectoryPath) const
-{
-	IPlatformFile &PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (!PlatformFile.DirectoryExists(*DirectoryPath))
-	{
-		return PlatformFile.CreateDirectoryTree(*DirectoryPath);
-	}
-	return true;
-}
-
-bool FGasXAttributeSetGenerator::IsReservedKeyword(const FString &Name) const
-{
-	static const TSet<FString> ReservedKeywords = {
-		TEXT("alignas"), TEXT("alignof"), TEXT("and"), TEXT("and_eq"), TEXT("asm"), TEXT("auto"),
-		TEXT("bitand"), TEXT("bitor"), TEXT("bool"), TEXT("break"), TEXT("case"), TEXT("catch"),
-		TEXT("char"), TEXT("char16_t"), TEXT("char32_t"), TEXT("class"), TEXT("compl"), TEXT("const"),
-		TEXT("constexpr"), TEXT("const_cast"), TEXT("continue"), TEXT("decltype"), TEXT("default"),
-		TEXT("delete"), TEXT("do"), TEXT("double"), TEXT("dynamic_cast"), TEXT("else"), TEXT("enum"),
-		TEXT("explicit"), TEXT("export"), TEXT("extern"), TEXT("false"), TEXT("float"), TEXT("for"),
-		TEXT("friend"), TEXT("goto"), TEXT("if"), TEXT("inline"), TEXT("int"), TEXT("long"),
-		TEXT("mutable"), TEXT("namespace"), TEXT("new"), TEXT("noexcept"), TEXT("not"), TEXT("not_eq"),
-		TEXT("nullptr"), TEXT("operator"), TEXT("or"), TEXT("or_eq"), TEXT("private"), TEXT("protected"),
-		TEXT("public"), TEXT("register"), TEXT("reinterpret_cast"), TEXT("return"), TEXT("short"),
-		TEXT("signed"), TEXT("sizeof"), TEXT("static"), TEXT("static_assert"), TEXT("static_cast"),
-		TEXT("struct"), TEXT("switch"), TEXT("template"), TEXT("this"), TEXT("thread_local"),
-		TEXT("throw"), TEXT("true"), TEXT("try"), TEXT("typedef"), TEXT("typeid"), TEXT("typename"),
-		TEXT("union"), TEXT("unsigned"), TEXT("using"), TEXT("virtual"), TEXT("void"), TEXT("volatile"),
-		TEXT("wchar_t"), TEXT("while"), TEXT("xor"), TEXT("xor_eq")};
-
-	return ReservedKeywords.Contains(Name.ToLower());
-}
 
-bool FGasXAttributeSetGenerator::IsValidIdentifier(const FString &Name) const
-{
-	if (Name.IsEmpty())
-	{
-		return false;
+		// WHY: Work on a copy so an unchanged row never dirties the package
+		FGasXAttributeMetadataRow MergedRow = *ExistingRow;
+		if (MergedRow.MergeGeneratedValues(RowData))
+		{
+			BeginModify();
+			*ExistingRow = MergedRow;
+			++NumUpdated;
+		}
 	}
 
-	// First character must be letter or underscore
-	TCHAR FirstChar = Name[0];
-	if (!FChar::IsAlpha(FirstChar) && FirstChar != TEXT('_'))
+	// WHY: Only drop rows the generator created; rows without a snapshot may have been added by hand
+	for (const FName &RowName : DataTable->GetRowNames())
 	{
-		return false;
-	}
+		if (SchemaRowNames.Contains(RowName))
+		{
+			continue;
+		}
 
-	// Remaining characters must be alphanumeric or underscore
-	for (int32 i = 1; i < Name.Len(); ++i)
-	{
-		TCHAR Ch = Name[i];
-		if (!FChar::IsAlnum(Ch) && Ch != TEXT('_'))
+		const FGasXAttributeMetadataRow *StaleRow = DataTable->FindRow<FGasXAttributeMetadataRow>(RowName, TEXT("GasXGenerator"), /*bWarnIfRowMissing*/ false);
+		if (StaleRow && StaleRow->HasGeneratedSnapshot())
 		{
-			return false;
+			BeginModify();
+			DataTable->RemoveRow(RowName);
+			++NumRemoved;
 		}
 	}
 
-	return true;
-}
-
-FString FGasXAttributeSetGenerator::MergeWithExistingFile(const FString &FilePath, const FString &NewGeneratedContent) const
-{
-	// WHY: If file doesn't exist, this is first generation - use new content as-is
-	if (!FPaths::FileExists(FilePath))
+	if (bModified)
 	{
-		UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("Creating new file: %s"), *FilePath);
-		return NewGeneratedContent;
+		DataTable->HandleDataTableChanged();
+		DataTable->MarkPackageDirty();
+		QueuePackageSave(DataTable->GetOutermost());
+		UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("Updated DataTable: %s (%d added, %d updated, %d removed)"), *OutputAssetPath, NumAdded, NumUpdated, NumRemoved);
 	}
-
-	FString ExistingContent;
-	if (!FFileHelper::LoadFileToString(ExistingContent, *FilePath))
+	else
 	{
-		UE_LOG(LogGasXAttributeSetGenerator, Warning, TEXT("Could not read existing file: %s. Using new content."), *FilePath);
-		return NewGeneratedContent;
+		UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("DataTable up to date: %s"), *OutputAssetPath);
 	}
 
-	UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("Merging with existing file: %s"), *FilePath);
+	return true;
 
-	// Start from the existing file so custom code outside guarded regions stays untouched
-	return ReplaceGuardedRegions(ExistingContent, NewGeneratedContent);
+#else
+	UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("GenerateMetadataTable requires WITH_EDITOR - cannot run in packaged build"));
+	return false;
+#endif
 }
 
-FString FGasXAttributeSetGenerator::ReplaceGuardedRegions(const FString &ExistingContent, const FString &NewContent) const
+bool FGasXAttributeSetGenerator::GenerateLevelCurveTable(const FGasXAttributeSetSchema &Schema, const FString &OutputAssetPath)
 {
-	// WHY: Preserve developer code outside guarded regions by editing the existing file in-place.
-	FString Result = ExistingContent;
-	struct FGuardBlock
-	{
-		FString Name;
-		FString BlockText;
-	};
+	// WHY: Level curves are schema-owned; rows are rewritten only when their keys changed so untouched tables stay clean
 
-	TArray<FGuardBlock> NewBlocks;
-	const FString BeginSignature = TEXT("//GEN-BEGIN:");
-	int32 SearchPosition = 0;
+#if WITH_EDITOR
+	FString PackagePath, AssetName;
+	OutputAssetPath.Split(TEXT("/"), &PackagePath, &AssetName, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	if (PackagePath.IsEmpty() || AssetName.IsEmpty())
+	{
+		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Invalid OutputAssetPath format: %s (expected /Game/Path/AssetName)"), *OutputAssetPath);
+		return false;
+	}
 
-	while (SearchPosition < NewContent.Len())
+	UCurveTable *CurveTable = nullptr;
+	if (FPackageName::DoesPackageExist(OutputAssetPath))
 	{
-		const int32 BeginIndex = NewContent.Find(BeginSignature, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchPosition);
-		if (BeginIndex == INDEX_NONE)
+		CurveTable = LoadObject<UCurveTable>(nullptr, *FString::Printf(TEXT("%s.%s"), *OutputAssetPath, *AssetName), nullptr, LOAD_NoWarn);
+		if (!CurveTable)
 		{
-			break;
+			UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Asset exists but is not a CurveTable: %s"), *OutputAssetPath);
+			return false;
 		}
 
-		const int32 BeginLineEnd = NewContent.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, BeginIndex);
-		const int32 SafeBeginLineEnd = BeginLineEnd == INDEX_NONE ? NewContent.Len() : BeginLineEnd + 1;
-
-		FString RegionName = NewContent.Mid(BeginIndex + BeginSignature.Len(), SafeBeginLineEnd - (BeginIndex + BeginSignature.Len()));
-		RegionName = RegionName.TrimStartAndEnd();
-
-		const FString EndMarker = FString::Printf(TEXT("//GEN-END: %s"), *RegionName);
-		const int32 EndIndex = NewContent.Find(EndMarker, ESearchCase::CaseSensitive, ESearchDir::FromStart, SafeBeginLineEnd);
-		if (EndIndex == INDEX_NONE)
+		if (CurveTable->GetCurveTableMode() == ECurveTableMode::SimpleCurves)
 		{
-			break;
+			UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("CurveTable %s uses simple curves; refusing to overwrite it"), *OutputAssetPath);
+			return false;
 		}
-
-		const int32 EndLineEnd = NewContent.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, EndIndex);
-		const int32 SafeEndLineEnd = EndLineEnd == INDEX_NONE ? NewContent.Len() : EndLineEnd + 1;
-
-		NewBlocks.Add({RegionName, NewContent.Mid(BeginIndex, SafeEndLineEnd - BeginIndex)});
-		SearchPosition = SafeEndLineEnd;
 	}
-
-	if (NewBlocks.Num() == 0)
+	else
 	{
-		return NewContent;
+		UPackage *Package = CreatePackage(*OutputAssetPath);
+		CurveTable = NewObject<UCurveTable>(Package, *AssetName, RF_Public | RF_Standalone | RF_Transactional);
+		FAssetRegistryModule::AssetCreated(CurveTable);
 	}
 
 	bool bModified = false;
-
-	for (const FGuardBlock &Block : NewBlocks)
+	auto BeginModify = [CurveTable, &bModified]()
 	{
-		const FString BeginNeedle = FString::Printf(TEXT("GEN-BEGIN: %s"), *Block.Name);
-		const FString EndNeedle = FString::Printf(TEXT("GEN-END: %s"), *Block.Name);
+		if (!bModified)
+		{
+			CurveTable->Modify();
+			bModified = true;
+		}
+	};
 
-		const int32 BeginNeedleIndex = Result.Find(BeginNeedle, ESearchCase::CaseSensitive);
-		if (BeginNeedleIndex == INDEX_NONE)
+	TSet<FName> SchemaRowNames;
+	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	{
+		if (Attr.LevelCurve.Num() == 0)
 		{
 			continue;
 		}
 
-		const int32 BlockStartLine = [&Result](int32 Index)
-		{
-			const int32 PrevNewline = Result.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromEnd, Index);
-			return PrevNewline == INDEX_NONE ? 0 : PrevNewline + 1;
-		}(BeginNeedleIndex);
+		const FName RowName = FName(*Attr.AttributeName);
+		SchemaRowNames.Add(RowName);
 
-		const int32 EndNeedleIndex = Result.Find(EndNeedle, ESearchCase::CaseSensitive, ESearchDir::FromStart, BeginNeedleIndex);
-		if (EndNeedleIndex == INDEX_NONE)
+		FRichCurve *ExistingCurve = CurveTable->FindRichCurve(RowName, TEXT("GasXGenerator"), /*bWarnIfNotFound*/ false);
+		if (ExistingCurve && ExistingCurve->GetNumKeys() == Attr.LevelCurve.Num())
 		{
-			continue;
+			bool bSame = true;
+			int32 KeyIndex = 0;
+			for (auto It = ExistingCurve->GetKeyIterator(); It; ++It, ++KeyIndex)
+			{
+				const FGasXLevelCurveKey &Key = Attr.LevelCurve[KeyIndex];
+				if (!FMath::IsNearlyEqual(It->Time, Key.Level) || !FMath::IsNearlyEqual(It->Value, Key.Value) || It->InterpMode != RCIM_Linear)
+				{
+					bSame = false;
+					break;
+				}
+			}
+
+			if (bSame)
+			{
+				continue;
+			}
 		}
 
-		const int32 BlockEndLine = [&Result](int32 Index)
+		BeginModify();
+		FRichCurve &Curve = ExistingCurve ? *ExistingCurve : CurveTable->AddRichCurve(RowName);
+		Curve.Reset();
+		for (const FGasXLevelCurveKey &Key : Attr.LevelCurve)
 		{
-			int32 NextNewline = Result.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index);
-			return NextNewline == INDEX_NONE ? Result.Len() : NextNewline + 1;
-		}(EndNeedleIndex);
-
-		Result = Result.Left(BlockStartLine) + Block.BlockText + Result.Mid(BlockEndLine);
-		bModified = true;
+			const FKeyHandle Handle = Curve.AddKey(Key.Level, Key.Value);
+			Curve.SetKeyInterpMode(Handle, RCIM_Linear);
+		}
 	}
 
-	return Result;
-}
-
-bool FGasXAttributeSetGenerator::GenerateMetadataTable(const FGasXAttributeSetSchema &Schema, const FString &OutputAssetPath)
-{
-	// WHY: Create a UDataTable with FGasXAttributeMetadataRow structure to hold designer-editable attribute values
-	// NOTE: This must run in editor context with AssetTools available
-
-#if WITH_EDITOR
-	// WHY: AssetTools provides the CreateAsset() API for programmatic asset generation
-	IAssetTools &AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
-
-	// WHY: DataTableFactory is required to create UDataTable instances
-	UDataTableFactory *Factory = NewObject<UDataTableFactory>();
-	Factory->Struct = FGasXAttributeMetadataRow::StaticStruct();
-
-	// WHY: Parse the output path into package and asset names
-	// Example: "/Game/Generated/Attributes/PlayerCoreMetadata" → Package="/Game/Generated/Attributes", Asset="PlayerCoreMetadata"
-	FString PackagePath, AssetName;
-	OutputAssetPath.Split(TEXT("/"), &PackagePath, &AssetName, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-	if (PackagePath.IsEmpty() || AssetName.IsEmpty())
+	TArray<FName> StaleRows;
+	for (const TPair<FName, FRealCurve *> &Row : CurveTable->GetRowMap())
 	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Invalid OutputAssetPath format: %s (expected /Game/Path/AssetName)"), *OutputAssetPath);
-		return false;
+		if (!SchemaRowNames.Contains(Row.Key))
+		{
+			StaleRows.Add(Row.Key);
+		}
 	}
-
-	// WHY: Create the DataTable asset in the specified package
-	UDataTable *DataTable = Cast<UDataTable>(AssetTools.CreateAsset(
-		AssetName,
-		PackagePath,
-		UDataTable::StaticClass(),
-		Factory));
-
-	if (!DataTable)
+	for (const FName &RowName : StaleRows)
 	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Failed to create DataTable asset: %s"), *OutputAssetPath);
-		return false;
+		BeginModify();
+		CurveTable->RemoveRow(RowName);
 	}
 
-	// WHY: Populate the DataTable with rows for each attribute from the schema
-	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
-	{
-	const FName RowName = FName(*Attr.AttributeName);
-	FGasXAttributeMetadataRow RowData;
-	RowData.BaseValue = Attr.DefaultValue;
-	RowData.MinValue = Attr.MinValue;
-	RowData.MaxValue = Attr.MaxValue;
-	RowData.Description = Attr.Description.IsEmpty()
-							  ? FString::Printf(TEXT("Metadata for %s attribute"), *Attr.AttributeName)
-							  : Attr.Description;
-
-	if (FGasXAttributeMetadataRow *ExistingRow = DataTable->FindRow<FGasXAttributeMetadataRow>(RowName, TEXT("GasXGenerator"), /*bWarnIfRowMissing*/ false))
+	if (bModified)
 	{
-		*ExistingRow = RowData;
+		CurveTable->OnCurveTableChanged().Broadcast();
+		CurveTable->MarkPackageDirty();
+		QueuePackageSave(CurveTable->GetOutermost());
+		UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("Updated CurveTable: %s (%d curves)"), *OutputAssetPath, SchemaRowNames.Num());
 	}
 	else
 	{
-		DataTable->AddRow(RowName, RowData);
-	}
-	}
-
-	// WHY: Mark the asset dirty so it will be saved with the project
-	DataTable->MarkPackageDirty();
-
-	// WHY: Trigger a save to disk
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath / AssetName, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Standalone;
-	SaveArgs.Error = GError;
-
-	if (!UPackage::SavePackage(DataTable->GetOutermost(), DataTable, *PackageFileName, SaveArgs))
-	{
-		UE_LOG(LogGasXAttributeSetGenerator, Warning, TEXT("Failed to save DataTable package: %s"), *PackageFileName);
-		// WHY: Don't return false - asset is still created in memory, just not saved yet
+		UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("CurveTable up to date: %s"), *OutputAssetPath);
 	}
 
-	UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("Successfully generated DataTable: %s (%d rows)"), *OutputAssetPath, Schema.Attributes.Num());
 	return true;
 
 #else
-	UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("GenerateMetadataTable requires WITH_EDITOR - cannot run in packaged build"));
+	UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("GenerateLevelCurveTable requires WITH_EDITOR - cannot run in packaged build"));
 	return false;
 #endif
 }
 
-bool FGasXAttributeSetGenerator::GenerateInitGameplayEffect(const FGasXAttributeSetSchema &Schema, const FString &OutputAssetPath)
+void FGasXAttributeSetGenerator::QueuePackageSave(UPackage *Package)
 {
-	// WHY: Create a UGameplayEffect asset with Instant modifiers to initialize attributes from schema defaults
-	// NOTE: This must run in editor context with AssetTools available
-
-#if WITH_EDITOR
-	// WHY: AssetTools provides the CreateAsset() API for programmatic asset generation
-	IAssetTools &AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
-
-	// WHY: Parse the output path into package and asset names
-	FString PackagePath, AssetName;
-	OutputAssetPath.Split(TEXT("/"), &PackagePath, &AssetName, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-	if (PackagePath.IsEmpty() || AssetName.IsEmpty())
+	if (Package)
 	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Invalid OutputAssetPath format: %s (expected /Game/Path/AssetName)"), *OutputAssetPath);
-		return false;
+		PendingPackageSaves.AddUnique(Package);
 	}
+}
 
-	// WHY: GameplayEffect assets are created as blueprints derived from UGameplayEffect
-	UBlueprintFactory *Factory = NewObject<UBlueprintFactory>();
-	Factory->ParentClass = UGameplayEffect::StaticClass();
-
-	// WHY: Create the GameplayEffect blueprint asset
-	UBlueprint *EffectBlueprint = Cast<UBlueprint>(AssetTools.CreateAsset(
-		AssetName,
-		PackagePath,
-		UBlueprint::StaticClass(),
-		Factory));
-
-	if (!EffectBlueprint)
+bool FGasXAttributeSetGenerator::SavePendingPackages()
+{
+#if WITH_EDITOR
+	TArray<UPackage *> PackagesToSave;
+	for (const TWeakObjectPtr<UPackage> &Package : PendingPackageSaves)
 	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Failed to create GameplayEffect blueprint: %s"), *OutputAssetPath);
-		return false;
+		if (Package.IsValid() && Package->IsDirty())
+		{
+			PackagesToSave.Add(Package.Get());
+		}
 	}
+	PendingPackageSaves.Reset();
 
-	// WHY: Access the CDO (Class Default Object) to configure the GameplayEffect properties
-	UGameplayEffect *EffectCDO = Cast<UGameplayEffect>(EffectBlueprint->GeneratedClass->GetDefaultObject());
-	if (!EffectCDO)
+	if (PackagesToSave.Num() == 0)
 	{
-		UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("Failed to get GameplayEffect CDO from blueprint: %s"), *OutputAssetPath);
-		return false;
+		return true;
 	}
 
-	// WHY: Init effects must be Instant duration to apply immediately
-	EffectCDO->DurationPolicy = EGameplayEffectDurationType::Instant;
-
-	// WHY: Add modifiers for each attribute in the schema
-	// NOTE: Each modifier sets the attribute's base value to the schema default
-	// NOTE: Attribute binding requires compiled reflection data; warn if generation happens before compile.
-	for (const FGasXAttributeDefinition &Attr : Schema.Attributes)
+	// WHY: One batched save per generation run, so checkout and cook/DDC invalidation only touch what changed
+	const bool bSaved = UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, /*bOnlyDirty*/ true);
+	if (bSaved)
 	{
-		FGameplayModifierInfo Modifier;
-
-		UE_LOG(LogGasXAttributeSetGenerator, Verbose, TEXT("Init GE modifier for %s requires manual attribute binding after compile."), *Attr.AttributeName);
-
-		// WHY: Override operation replaces the attribute's current value
-		Modifier.ModifierOp = EGameplayModOp::Override;
-
-		// WHY: Use a constant magnitude equal to the schema default
-		FScalableFloat ScalableValue;
-		ScalableValue.Value = Attr.DefaultValue;
-		Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(ScalableValue);
-
-		EffectCDO->Modifiers.Add(Modifier);
+		UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("Saved %d generated package(s)"), PackagesToSave.Num());
 	}
-
-	// WHY: Mark the blueprint dirty so it will be saved with the project
-	EffectBlueprint->MarkPackageDirty();
-
-	// WHY: Compile the blueprint to ensure the changes are applied
-	FKismetEditorUtilities::CompileBlueprint(EffectBlueprint, EBlueprintCompileOptions::None);
-
-	// WHY: Trigger a save to disk
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath / AssetName, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Standalone;
-	SaveArgs.Error = GError;
-
-	if (!UPackage::SavePackage(EffectBlueprint->GetOutermost(), EffectBlueprint, *PackageFileName, SaveArgs))
+	else
 	{
-		UE_LOG(LogGasXAttributeSetGenerator, Warning, TEXT("Failed to save GameplayEffect package: %s"), *PackageFileName);
-		// WHY: Don't return false - asset is still created in memory, just not saved yet
+		UE_LOG(LogGasXAttributeSetGenerator, Warning, TEXT("Failed to save one or more of %d generated package(s)"), PackagesToSave.Num());
 	}
-
-	UE_LOG(LogGasXAttributeSetGenerator, Log, TEXT("Successfully generated Init GameplayEffect: %s (%d modifiers)"), *OutputAssetPath, Schema.Attributes.Num());
-	return true;
-
+	return bSaved;
 #else
-	UE_LOG(LogGasXAttributeSetGenerator, Error, TEXT("GenerateInitGameplayEffect requires WITH_EDITOR - cannot run in packaged build"));
+	PendingPackageSaves.Reset();
 	return false;
 #endif
 }
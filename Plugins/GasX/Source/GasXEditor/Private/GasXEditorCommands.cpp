@@ -2,8 +2,13 @@
 
 #include "GasXEditorCommands.h"
 #include "GasXAttributeSetGenerator.h"
-#include "GasXSchemaParser.h"
+#include "GasXSchemaGraph.h"
+#include "GasXSchemaWatcher.h"
 #include "Misc/Paths.h"
+#include "GasXBakedAttributeDefaults.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "FileHelpers.h"
+#include "UObject/Package.h"
 
 FAutoConsoleCommand FGasXEditorCommands::GenerateAttributeSetCmd(
 	TEXT("GasX.GenerateAttributeSet"),
@@ -11,6 +16,26 @@ FAutoConsoleCommand FGasXEditorCommands::GenerateAttributeSetCmd(
 	FConsoleCommandWithArgsDelegate::CreateStatic(&FGasXEditorCommands::GenerateAttributeSetCommand)
 );
 
+FAutoConsoleCommand FGasXEditorCommands::WatchSchemasCmd(
+	TEXT("GasX.WatchSchemas"),
+	TEXT("Regenerate AttributeSets automatically when schema JSON files change. Usage: GasX.WatchSchemas [schema-dir ...] (defaults to Plugins/GasX/Schemas)"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FGasXEditorCommands::WatchSchemasCommand)
+);
+
+FAutoConsoleCommand FGasXEditorCommands::UnwatchSchemasCmd(
+	TEXT("GasX.UnwatchSchemas"),
+	TEXT("Stop schema watch mode started with GasX.WatchSchemas"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FGasXEditorCommands::UnwatchSchemasCommand)
+);
+
+FAutoConsoleCommand FGasXEditorCommands::BakeAttributeDefaultsCmd(
+	TEXT("GasX.BakeAttributeDefaults"),
+	TEXT("Bake every attribute metadata DataTable into /Game/Generated/Attributes/BakedAttributeDefaults (also done automatically on cook)"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FGasXEditorCommands::BakeAttributeDefaultsCommand)
+);
+
+TUniquePtr<FGasXSchemaWatcher> FGasXEditorCommands::SchemaWatcher;
+
 void FGasXEditorCommands::RegisterCommands()
 {
 	// Commands are auto-registered via FAutoConsoleCommand
@@ -19,7 +44,8 @@ void FGasXEditorCommands::RegisterCommands()
 
 void FGasXEditorCommands::UnregisterCommands()
 {
-	// Auto-cleanup
+	// Auto-cleanup for console commands; the watcher holds DirectoryWatcher and ticker registrations
+	SchemaWatcher.Reset();
 }
 
 void FGasXEditorCommands::GenerateAttributeSetCommand(const TArray<FString>& Args)
@@ -56,21 +82,32 @@ void FGasXEditorCommands::GenerateAttributeSetCommand(const TArray<FString>& Arg
 		return;
 	}
 
-	FGasXAttributeSetSchema Schema;
-	FString ParseError;
-	if (!FGasXSchemaParser::LoadSchemaFromJson(JsonPath, Schema, ParseError))
+	// WHY: Resolve Extends/Include through the schema graph so the generator only sees the flattened schema
+	FGasXSchemaGraph Graph;
+	Graph.AddSchemas({JsonPath}, FGasXSchemaParser::GetCacheDirectory(FPaths::ProjectSavedDir()));
+	for (const FGasXSchemaDiagnostic& Diagnostic : Graph.GetDiagnostics(JsonPath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s"), *Diagnostic.ToString());
+	}
+
+	const FGasXAttributeSetSchema* ResolvedSchema = Graph.GetResolvedSchema(JsonPath);
+	if (!ResolvedSchema)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to parse schema: %s"), *JsonPath);
+		return;
+	}
+
+	if (ResolvedSchema->bIsFragment)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to parse schema: %s"), *ParseError);
+		UE_LOG(LogTemp, Error, TEXT("%s is a shared fragment; generate a schema that includes it instead"), *JsonPath);
 		return;
 	}
 
+	const FGasXAttributeSetSchema& Schema = *ResolvedSchema;
+
 	// Determine output paths based on schema
-	FString PluginDir = FPaths::ProjectPluginsDir() / TEXT("GasX");
-	FString ModuleDir = PluginDir / TEXT("Source") / Schema.TargetModule;
-	FString OutputDir = ModuleDir / Schema.TargetDirectory;
-	
-	FString HeaderPath = OutputDir / (Schema.AttributeSetClassName + TEXT(".h"));
-	FString SourcePath = FPaths::Combine(ModuleDir, TEXT("Private"), TEXT("Attributes"), Schema.AttributeSetClassName + TEXT(".cpp"));
+	FString HeaderPath, SourcePath;
+	FGasXAttributeSetGenerator::ResolveOutputPaths(Schema, HeaderPath, SourcePath);
 
 	FGasXAttributeSetGenerator Generator;
 	if (Generator.GenerateAttributeSet(Schema, HeaderPath, SourcePath))
@@ -85,3 +122,71 @@ void FGasXEditorCommands::GenerateAttributeSetCommand(const TArray<FString>& Arg
 		UE_LOG(LogTemp, Error, TEXT("Failed to generate AttributeSet"));
 	}
 }
+
+void FGasXEditorCommands::WatchSchemasCommand(const TArray<FString>& Args)
+{
+	TArray<FString> Directories;
+	for (const FString& Arg : Args)
+	{
+		const FString Directory = Arg.TrimQuotes();
+		Directories.Add(FPaths::IsRelative(Directory) ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Directory) : Directory);
+	}
+
+	if (Directories.Num() == 0)
+	{
+		Directories.Add(FGasXSchemaWatcher::GetDefaultSchemaDirectory());
+	}
+
+	if (!SchemaWatcher.IsValid())
+	{
+		SchemaWatcher = MakeUnique<FGasXSchemaWatcher>();
+	}
+
+	if (SchemaWatcher->Start(Directories))
+	{
+		UE_LOG(LogTemp, Display, TEXT("GasX schema watch mode enabled (%d director%s)"), Directories.Num(), Directories.Num() == 1 ? TEXT("y") : TEXT("ies"));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("GasX schema watch mode could not watch any of the given directories"));
+		SchemaWatcher.Reset();
+	}
+}
+
+void FGasXEditorCommands::UnwatchSchemasCommand(const TArray<FString>& Args)
+{
+	if (!SchemaWatcher.IsValid())
+	{
+		UE_LOG(LogTemp, Display, TEXT("GasX schema watch mode is not running"));
+		return;
+	}
+
+	SchemaWatcher.Reset();
+	UE_LOG(LogTemp, Display, TEXT("GasX schema watch mode disabled"));
+}
+
+void FGasXEditorCommands::BakeAttributeDefaultsCommand(const TArray<FString>& Args)
+{
+	const FString PackageName = TEXT("/Game/Generated/Attributes/BakedAttributeDefaults");
+	const FString AssetName = FPackageName::GetShortName(PackageName);
+
+	UGasXBakedAttributeDefaults* Baked = LoadObject<UGasXBakedAttributeDefaults>(nullptr, *FString::Printf(TEXT("%s.%s"), *PackageName, *AssetName), nullptr, LOAD_NoWarn);
+	if (!Baked)
+	{
+		UPackage* Package = CreatePackage(*PackageName);
+		Baked = NewObject<UGasXBakedAttributeDefaults>(Package, *AssetName, RF_Public | RF_Standalone);
+		FAssetRegistryModule::AssetCreated(Baked);
+	}
+
+	Baked->Modify();
+	Baked->BakeAllMetadataTables();
+	Baked->MarkPackageDirty();
+
+	if (!UEditorLoadingAndSavingUtils::SavePackages({Baked->GetOutermost()}, /*bOnlyDirty*/ true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to save %s"), *PackageName);
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Baked %d attribute defaults into %s"), Baked->GetNumRows(), *PackageName);
+}
@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXGenerateCommandlet.h"
+#include "GasXAttributeSetGenerator.h"
+#include "GasXSchemaGraph.h"
+#include "GasXSchemaParser.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreMisc.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXGenerateCommandlet, Log, All);
+
+UGasXGenerateCommandlet::UGasXGenerateCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UGasXGenerateCommandlet::Main(const FString& Params)
+{
+	// WHY: Startup cost is the main reason this commandlet exists, so report it before doing any work
+	UE_LOG(LogGasXGenerateCommandlet, Display, TEXT("Engine startup: %.2f s"), FPlatformTime::Seconds() - GStartTime);
+
+	FString Glob;
+	if (!FParse::Value(*Params, TEXT("Schemas="), Glob))
+	{
+		UE_LOG(LogGasXGenerateCommandlet, Error, TEXT("Usage: -run=GasXGenerate -Schemas=<glob> [-Verify] [-CodeOnly] [-NoSchemaCache]"));
+		return EGasXGenerateExitCode::InvalidArguments;
+	}
+
+	const bool bVerify = FParse::Param(*Params, TEXT("Verify"));
+	const bool bCodeOnly = FParse::Param(*Params, TEXT("CodeOnly"));
+	const FString SchemaCacheDirectory = FParse::Param(*Params, TEXT("NoSchemaCache")) ? FString() : FGasXSchemaParser::GetCacheDirectory(FPaths::ProjectSavedDir());
+
+	const TArray<FString> SchemaFiles = FGasXSchemaParser::FindSchemaFiles(Glob, FPaths::ProjectDir());
+	if (SchemaFiles.Num() == 0)
+	{
+		UE_LOG(LogGasXGenerateCommandlet, Error, TEXT("No schema files matched: %s"), *Glob);
+		return EGasXGenerateExitCode::InvalidArguments;
+	}
+
+	UE_LOG(LogGasXGenerateCommandlet, Display, TEXT("%s %d schema(s) matching %s"), bVerify ? TEXT("Verifying") : TEXT("Generating"), SchemaFiles.Num(), *Glob);
+
+	const double RunStartTime = FPlatformTime::Seconds();
+
+	// WHY: Parsing is independent per file, so the graph loads everything up front on worker threads; generation stays on the game thread
+	FGasXSchemaGraph Graph;
+	Graph.AddSchemas(SchemaFiles, SchemaCacheDirectory);
+
+	int32 NumCached = 0;
+	for (const FString& SchemaPath : SchemaFiles)
+	{
+		NumCached += Graph.WasLoadedFromCache(SchemaPath) ? 1 : 0;
+	}
+	UE_LOG(LogGasXGenerateCommandlet, Display, TEXT("Loaded and resolved %d schema(s) (%d from cache) in %.2f ms"),
+		SchemaFiles.Num(), NumCached, (FPlatformTime::Seconds() - RunStartTime) * 1000.0);
+
+	// WHY: Defer asset saves so every touched DataTable and GameplayEffect is written in one batch at the end
+	FGasXAttributeSetGenerator Generator;
+	Generator.bDeferPackageSaves = true;
+	int32 NumFailed = 0;
+	int32 NumOutOfDate = 0;
+
+	for (const FString& SchemaPath : SchemaFiles)
+	{
+		const double SchemaStartTime = FPlatformTime::Seconds();
+
+		for (const FGasXSchemaDiagnostic& Diagnostic : Graph.GetDiagnostics(SchemaPath))
+		{
+			if (Diagnostic.bIsError)
+			{
+				UE_LOG(LogGasXGenerateCommandlet, Error, TEXT("%s"), *Diagnostic.ToString());
+			}
+			else
+			{
+				UE_LOG(LogGasXGenerateCommandlet, Warning, TEXT("%s"), *Diagnostic.ToString());
+			}
+		}
+
+		const FGasXAttributeSetSchema* ResolvedSchema = Graph.GetResolvedSchema(SchemaPath);
+		if (!ResolvedSchema)
+		{
+			++NumFailed;
+			continue;
+		}
+
+		if (ResolvedSchema->bIsFragment)
+		{
+			UE_LOG(LogGasXGenerateCommandlet, Display, TEXT("  Skipping fragment %s"), *SchemaPath);
+			continue;
+		}
+
+		FGasXAttributeSetSchema Schema = *ResolvedSchema;
+		FString Error;
+
+		if (bCodeOnly)
+		{
+			Schema.bGenerateMetadataTable = false;
+		}
+
+		FString HeaderPath, SourcePath;
+		FGasXAttributeSetGenerator::ResolveOutputPaths(Schema, HeaderPath, SourcePath);
+
+		if (bVerify)
+		{
+			TArray<FString> OutOfDateFiles;
+			if (!Generator.CollectOutOfDateFiles(Schema, HeaderPath, SourcePath, OutOfDateFiles, Error))
+			{
+				UE_LOG(LogGasXGenerateCommandlet, Error, TEXT("%s: %s"), *SchemaPath, *Error);
+				++NumFailed;
+				continue;
+			}
+
+			for (const FString& OutOfDateFile : OutOfDateFiles)
+			{
+				UE_LOG(LogGasXGenerateCommandlet, Warning, TEXT("Out of date: %s (schema %s)"), *OutOfDateFile, *SchemaPath);
+			}
+			NumOutOfDate += OutOfDateFiles.Num();
+		}
+		else if (!Generator.GenerateAttributeSet(Schema, HeaderPath, SourcePath))
+		{
+			UE_LOG(LogGasXGenerateCommandlet, Error, TEXT("%s: generation failed"), *SchemaPath);
+			++NumFailed;
+			continue;
+		}
+
+		UE_LOG(LogGasXGenerateCommandlet, Display, TEXT("  %-40s %8.2f ms"), *Schema.AttributeSetClassName, (FPlatformTime::Seconds() - SchemaStartTime) * 1000.0);
+	}
+
+	if (!bVerify && !Generator.SavePendingPackages())
+	{
+		UE_LOG(LogGasXGenerateCommandlet, Error, TEXT("Failed to save generated assets"));
+		++NumFailed;
+	}
+
+	UE_LOG(LogGasXGenerateCommandlet, Display, TEXT("Processed %d schema(s) in %.2f ms: %d failed, %d out-of-date file(s)"),
+		SchemaFiles.Num(), (FPlatformTime::Seconds() - RunStartTime) * 1000.0, NumFailed, NumOutOfDate);
+
+	if (NumFailed > 0)
+	{
+		return EGasXGenerateExitCode::GenerationFailed;
+	}
+
+	return NumOutOfDate > 0 ? EGasXGenerateExitCode::OutOfDate : EGasXGenerateExitCode::Success;
+}
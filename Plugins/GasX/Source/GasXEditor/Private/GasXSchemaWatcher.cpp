@@ -0,0 +1,248 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXSchemaWatcher.h"
+#include "GasXAttributeSetGenerator.h"
+#include "HAL/FileManager.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXSchemaWatcher, Log, All);
+
+#define LOCTEXT_NAMESPACE "GasXSchemaWatcher"
+
+FGasXSchemaWatcher::FGasXSchemaWatcher()
+{
+}
+
+FGasXSchemaWatcher::~FGasXSchemaWatcher()
+{
+	Stop();
+}
+
+FString FGasXSchemaWatcher::GetDefaultSchemaDirectory()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectPluginsDir() / TEXT("GasX") / TEXT("Schemas"));
+}
+
+bool FGasXSchemaWatcher::Start(const TArray<FString>& Directories)
+{
+	Stop();
+
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get();
+	if (!DirectoryWatcher)
+	{
+		UE_LOG(LogGasXSchemaWatcher, Error, TEXT("DirectoryWatcher is not available on this platform"));
+		return false;
+	}
+
+	for (const FString& Directory : Directories)
+	{
+		const FString FullPath = FPaths::ConvertRelativePathToFull(Directory);
+		if (!FPaths::DirectoryExists(FullPath))
+		{
+			UE_LOG(LogGasXSchemaWatcher, Warning, TEXT("Schema directory does not exist: %s"), *FullPath);
+			continue;
+		}
+
+		FWatchedDirectory Watched;
+		Watched.Path = FullPath;
+		if (DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+				FullPath,
+				IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FGasXSchemaWatcher::OnDirectoryChanged),
+				Watched.Handle,
+				0))
+		{
+			WatchedDirectories.Add(Watched);
+			UE_LOG(LogGasXSchemaWatcher, Log, TEXT("Watching schema directory: %s"), *FullPath);
+		}
+		else
+		{
+			UE_LOG(LogGasXSchemaWatcher, Warning, TEXT("Failed to watch schema directory: %s"), *FullPath);
+		}
+	}
+
+	if (WatchedDirectories.Num() == 0)
+	{
+		return false;
+	}
+
+	// WHY: Load every schema up front so the graph knows which sets depend on a fragment before the first edit
+	TArray<FString> ExistingSchemas;
+	for (const FWatchedDirectory& Watched : WatchedDirectories)
+	{
+		IFileManager::Get().FindFilesRecursive(ExistingSchemas, *Watched.Path, TEXT("*.json"), /*Files*/ true, /*Directories*/ false, /*bClearFileNames*/ false);
+	}
+	Graph.AddSchemas(ExistingSchemas, FGasXSchemaParser::GetCacheDirectory(FPaths::ProjectSavedDir()));
+
+	// WHY: Poll at a fraction of the debounce window so a flush lands well within a second of the last save
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FGasXSchemaWatcher::Tick),
+		FMath::Min(0.1f, DebounceSeconds * 0.5f));
+
+	return true;
+}
+
+void FGasXSchemaWatcher::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// WHY: The DirectoryWatcher module may already be gone during editor shutdown
+	if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+		{
+			for (const FWatchedDirectory& Watched : WatchedDirectories)
+			{
+				DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Watched.Path, Watched.Handle);
+			}
+		}
+	}
+
+	WatchedDirectories.Reset();
+	PendingSchemas.Reset();
+	Graph = FGasXSchemaGraph();
+}
+
+void FGasXSchemaWatcher::OnDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
+{
+	for (const FFileChangeData& Change : FileChanges)
+	{
+		// WHY: Removing a schema must not delete generated code; developers may still own custom code in those files
+		if (Change.Action == FFileChangeData::FCA_Removed)
+		{
+			continue;
+		}
+
+		if (!FPaths::GetExtension(Change.Filename).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+
+		PendingSchemas.Add(FPaths::ConvertRelativePathToFull(Change.Filename));
+		LastChangeTime = FPlatformTime::Seconds();
+	}
+}
+
+bool FGasXSchemaWatcher::Tick(float DeltaTime)
+{
+	if (PendingSchemas.Num() > 0 && FPlatformTime::Seconds() - LastChangeTime >= DebounceSeconds)
+	{
+		FlushPendingSchemas();
+	}
+
+	return true;
+}
+
+void FGasXSchemaWatcher::FlushPendingSchemas()
+{
+	TArray<FString> Schemas = PendingSchemas.Array();
+	PendingSchemas.Reset();
+	Schemas.Sort();
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// WHY: Drop the changed files and everything resolved from them, then reload only those files.
+	// Editing a shared fragment therefore regenerates exactly the sets that include it.
+	Graph.Invalidate(Schemas);
+
+	// NOTE: Removed schemas still appear as rename/modify events on some platforms
+	TArray<FString> ExistingSchemas = Schemas;
+	ExistingSchemas.RemoveAll([](const FString& SchemaPath) { return !FPaths::FileExists(SchemaPath); });
+	Graph.AddSchemas(ExistingSchemas, FGasXSchemaParser::GetCacheDirectory(FPaths::ProjectSavedDir()));
+
+	// WHY: One generator per flush so assets touched by several schemas are saved once, in a single batch
+	FGasXAttributeSetGenerator Generator;
+	Generator.bDeferPackageSaves = true;
+
+	TArray<FString> Regenerated;
+	TArray<FString> Failed;
+	for (const FString& SchemaPath : Graph.GetDependentSchemas(Schemas))
+	{
+		const FString SchemaName = FPaths::GetBaseFilename(SchemaPath);
+		FString Error;
+		if (const FGasXAttributeSetSchema* ResolvedSchema = Graph.GetResolvedSchema(SchemaPath))
+		{
+			if (RegenerateSchema(Generator, *ResolvedSchema, Error))
+			{
+				Regenerated.Add(SchemaName);
+				continue;
+			}
+		}
+		else
+		{
+			TArray<FString> Errors;
+			for (const FGasXSchemaDiagnostic& Diagnostic : Graph.GetDiagnostics(SchemaPath))
+			{
+				if (Diagnostic.bIsError)
+				{
+					Errors.Add(Diagnostic.ToString());
+				}
+			}
+			Error = FString::Join(Errors, TEXT("\n"));
+		}
+
+		UE_LOG(LogGasXSchemaWatcher, Error, TEXT("Regeneration failed for %s: %s"), *SchemaPath, *Error);
+		Failed.Add(FString::Printf(TEXT("%s: %s"), *SchemaName, *Error));
+	}
+
+	if (!Generator.SavePendingPackages())
+	{
+		Failed.Add(TEXT("Failed to save generated assets (see Output Log)"));
+	}
+
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	UE_LOG(LogGasXSchemaWatcher, Log, TEXT("Regenerated %d schema(s), %d failed in %.1f ms"), Regenerated.Num(), Failed.Num(), ElapsedMs);
+
+	if (Regenerated.Num() > 0)
+	{
+		ShowNotification(FText::Format(
+			LOCTEXT("RegeneratedSchemas", "GasX regenerated: {0}"),
+			FText::FromString(FString::Join(Regenerated, TEXT(", ")))), true);
+	}
+
+	if (Failed.Num() > 0)
+	{
+		ShowNotification(FText::Format(
+			LOCTEXT("FailedSchemas", "GasX schema regeneration failed:\n{0}"),
+			FText::FromString(FString::Join(Failed, TEXT("\n")))), false);
+	}
+}
+
+bool FGasXSchemaWatcher::RegenerateSchema(FGasXAttributeSetGenerator& Generator, const FGasXAttributeSetSchema& Schema, FString& OutError) const
+{
+	FString HeaderPath, SourcePath;
+	FGasXAttributeSetGenerator::ResolveOutputPaths(Schema, HeaderPath, SourcePath);
+
+	if (!Generator.GenerateAttributeSet(Schema, HeaderPath, SourcePath))
+	{
+		OutError = TEXT("Generation failed (see Output Log)");
+		return false;
+	}
+
+	return true;
+}
+
+void FGasXSchemaWatcher::ShowNotification(const FText& Message, bool bSuccess) const
+{
+	FNotificationInfo Info(Message);
+	Info.ExpireDuration = bSuccess ? 3.0f : 8.0f;
+	Info.bUseSuccessFailIcons = true;
+
+	TSharedPtr<SNotificationItem> Item = FSlateNotificationManager::Get().AddNotification(Info);
+	if (Item.IsValid())
+	{
+		Item->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
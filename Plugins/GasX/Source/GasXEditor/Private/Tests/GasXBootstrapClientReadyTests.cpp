@@ -0,0 +1,199 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "Attributes/PlayerCoreAttributes.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "GasXAttributeBootstrapComponent.h"
+#include "GasXPIETestUtils.h"
+#include "Net/Core/Misc/NetConditionGroupManager.h"
+#include "Net/NetworkSubsystem.h"
+#include "Tests/GasXTestActors.h"
+
+/**
+ * Client-side attribute readiness in a dedicated server PIE session with one client.
+ *
+ * WHY: The server holds the set back with a net condition group the client is not in, so the client receives
+ * ReadyAttributeSets with an unmapped reference first; letting the set through must re-run the OnRep and fire
+ * OnAttributesReady exactly once, with the set's replicated values already in place.
+ */
+namespace GasXBootstrapClientReadyTest
+{
+	static constexpr float ServerHealth = 42.0f;
+	static constexpr double HeldBackSeconds = 1.0;
+
+	static const FName HeldBackGroup(TEXT("GasXTestHeldBack"));
+
+	struct FState
+	{
+		TWeakObjectPtr<UWorld> ServerWorld;
+		TWeakObjectPtr<UWorld> ClientWorld;
+		TWeakObjectPtr<APlayerController> RemoteViewer;
+		TWeakObjectPtr<AGasXTestBootstrapActor> ServerActor;
+		TWeakObjectPtr<AGasXTestBootstrapActor> ClientActor;
+		double HeldBackUntil = 0.0;
+	};
+
+	static bool FindSession(FState& State)
+	{
+		UWorld* ServerWorld = nullptr;
+		TArray<UWorld*> ClientWorlds;
+		if (!GasXPIETest::FindWorlds(1, ServerWorld, ClientWorlds))
+		{
+			return false;
+		}
+
+		for (FConstPlayerControllerIterator It = ServerWorld->GetPlayerControllerIterator(); It; ++It)
+		{
+			APlayerController* PlayerController = It->Get();
+			if (PlayerController && !PlayerController->IsLocalController())
+			{
+				State.ServerWorld = ServerWorld;
+				State.ClientWorld = ClientWorlds[0];
+				State.RemoteViewer = PlayerController;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static AGasXTestBootstrapActor* FindClientActor(const FState& State)
+	{
+		UWorld* ClientWorld = State.ClientWorld.Get();
+		if (!ClientWorld)
+		{
+			return nullptr;
+		}
+
+		for (TActorIterator<AGasXTestBootstrapActor> It(ClientWorld); It; ++It)
+		{
+			return *It;
+		}
+		return nullptr;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXBootstrapClientReadyTest,
+	"GasX.Editor.Bootstrap.ClientAttributesReady",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXBootstrapClientReadyTest::RunTest(const FString& Parameters)
+{
+	using namespace GasXBootstrapClientReadyTest;
+
+	if (!GEditor)
+	{
+		AddError(TEXT("Requires the editor"));
+		return false;
+	}
+
+	GasXPIETest::StartSession(PIE_Client, 1);
+
+	TSharedRef<FState> State = MakeShared<FState>();
+
+	ADD_LATENT_AUTOMATION_COMMAND(GasXPIETest::FWaitUntilCommand(this, TEXT("PIE server with one remote client"), [State]()
+	{
+		return FindSession(*State);
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		UWorld* ServerWorld = State->ServerWorld.Get();
+		UNetworkSubsystem* NetworkSubsystem = ServerWorld ? ServerWorld->GetSubsystem<UNetworkSubsystem>() : nullptr;
+		if (HasAnyErrors() || !TestNotNull(TEXT("Network subsystem on the server"), NetworkSubsystem))
+		{
+			return true;
+		}
+
+		// NOTE: The server bootstrap runs inside SpawnActor, before the actor's first net update
+		AGasXTestBootstrapActor* Actor = ServerWorld->SpawnActor<AGasXTestBootstrapActor>();
+		UAbilitySystemComponent* ASC = Actor->GetAbilitySystemComponent();
+		UPlayerCoreAttributes* Set = const_cast<UPlayerCoreAttributes*>(ASC->GetSet<UPlayerCoreAttributes>());
+		if (!TestNotNull(TEXT("Server bootstrap added the set"), Set))
+		{
+			Actor->Destroy();
+			return true;
+		}
+		TestEqual(TEXT("Server ready once during BeginPlay"), Actor->NumReadyBroadcasts, 1);
+
+		ASC->SetNumericAttributeBase(UPlayerCoreAttributes::GetHealthAttribute(), ServerHealth);
+
+		// WHY: Same registration the replication LOD subsystem uses; nobody is in the group yet
+		ASC->RemoveReplicatedSubObject(Set);
+		ASC->AddReplicatedSubObject(Set, COND_NetGroup);
+		NetworkSubsystem->GetNetConditionGroupManager().RegisterSubObjectInGroup(Set, HeldBackGroup);
+
+		State->ServerActor = Actor;
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(GasXPIETest::FWaitUntilCommand(this, TEXT("Test actor replicates to the client"), [this, State]()
+	{
+		State->ClientActor = FindClientActor(*State);
+		if (HasAnyErrors() || State->ClientActor.IsValid())
+		{
+			State->HeldBackUntil = FPlatformTime::Seconds() + HeldBackSeconds;
+			return true;
+		}
+		return false;
+	}));
+
+	// NOTE: Give the held-back reference time to prove it does not count as ready
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		AGasXTestBootstrapActor* ClientActor = State->ClientActor.Get();
+		if (HasAnyErrors() || !ClientActor)
+		{
+			return true;
+		}
+
+		if (FPlatformTime::Seconds() < State->HeldBackUntil)
+		{
+			TestFalse(TEXT("Client not ready while the set is held back"), ClientActor->GetBootstrap()->AreAttributesReady());
+			return false;
+		}
+
+		TestNull(TEXT("Set has not reached the client"), ClientActor->GetAbilitySystemComponent()->GetSet<UPlayerCoreAttributes>());
+		TestEqual(TEXT("No ready broadcast while the reference is unmapped"), ClientActor->NumReadyBroadcasts, 0);
+
+		if (APlayerController* RemoteViewer = State->RemoteViewer.Get())
+		{
+			RemoteViewer->IncludeInNetConditionGroup(HeldBackGroup);
+		}
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(GasXPIETest::FWaitUntilCommand(this, TEXT("Client reports attributes ready once the set maps"), [this, State]()
+	{
+		const AGasXTestBootstrapActor* ClientActor = State->ClientActor.Get();
+		return HasAnyErrors() || !ClientActor || ClientActor->GetBootstrap()->AreAttributesReady();
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		if (const AGasXTestBootstrapActor* ClientActor = State->ClientActor.Get(); ClientActor && !HasAnyErrors())
+		{
+			TestEqual(TEXT("Client broadcasts ready exactly once"), ClientActor->NumReadyBroadcasts, 1);
+			// WHY: The broadcast waits a tick after the OnRep, so the set's own OnReps have delivered its values
+			if (TestTrue(TEXT("Set is on the client ASC when ready fires"), ClientActor->HealthAtReady.IsSet()))
+			{
+				TestEqual(TEXT("Replicated values are in place when ready fires"), ClientActor->HealthAtReady.GetValue(), ServerHealth);
+			}
+		}
+
+		if (AGasXTestBootstrapActor* ServerActor = State->ServerActor.Get())
+		{
+			ServerActor->Destroy();
+		}
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand());
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
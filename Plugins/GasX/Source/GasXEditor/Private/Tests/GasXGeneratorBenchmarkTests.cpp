@@ -0,0 +1,315 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "GasXAttributeSetEmitter.h"
+#include "GasXSchemaParser.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+/**
+ * Code generator scaling benchmarks.
+ *
+ * Synthesizes a schema with N attributes (floats, int32s, arrays, level curves and flags), writes it to disk and
+ * times each stage of GenerateAttributeSet on it: FGasXSchemaParser::LoadSchemaFromJson (cold, then from the
+ * parse cache), ValidateSchema, header and source generation, and MergeWithExistingFile against files from an
+ * older version of the schema with custom code between every guarded region. Reports attributes per second
+ * per stage and peak memory growth. Results are appended to Saved/GasX/Benchmarks/GeneratorScaling.csv.
+ *
+ * Headless run:
+ *   UnrealEditor-Cmd GasXtension.uproject -ExecCmds="Automation RunTests GasX.Editor.Benchmark.Generator; Quit" -nullrhi -unattended
+ *
+ * Regression thresholds are console variables (0 disables a check).
+ */
+namespace GasXGeneratorBenchmark
+{
+	static TAutoConsoleVariable<float> CVarMaxPerAttributeMicroseconds(
+		TEXT("GasX.Benchmark.Generator.MaxPerAttributeMicroseconds"), 0.0f,
+		TEXT("Fail generator benchmarks whose total time per attribute exceeds this (0 = no limit)"));
+
+	static TAutoConsoleVariable<float> CVarMaxPerAttributeGrowth(
+		TEXT("GasX.Benchmark.Generator.MaxPerAttributeGrowth"), 0.0f,
+		TEXT("Fail generator benchmarks whose time per attribute exceeds this multiple of the 100-attribute run, catching superlinear stages (0 = no limit)"));
+
+	static TAutoConsoleVariable<float> CVarMaxPeakMemoryMB(
+		TEXT("GasX.Benchmark.Generator.MaxPeakMemoryMB"), 0.0f,
+		TEXT("Fail generator benchmarks whose peak physical memory growth exceeds this (0 = no limit)"));
+
+	/** Size of the run per-attribute growth is measured against. */
+	static constexpr int32 BaselineNumAttributes = 100;
+
+	struct FResult
+	{
+		int32 NumAttributes = 0;
+		double ParseMs = 0.0;
+		double CachedParseMs = 0.0;
+		double ValidateMs = 0.0;
+		double GenerateHeaderMs = 0.0;
+		double GenerateSourceMs = 0.0;
+		double MergeMs = 0.0;
+		int64 GeneratedBytes = 0;
+		double PeakMemoryMB = 0.0;
+		bool bSucceeded = false;
+		FString Error;
+
+		double GetTotalMs() const { return ParseMs + ValidateMs + GenerateHeaderMs + GenerateSourceMs + MergeMs; }
+		double GetPerAttributeMicroseconds() const { return NumAttributes > 0 ? GetTotalMs() * 1000.0 / NumAttributes : 0.0; }
+	};
+
+	static double AttributesPerSecond(int32 NumAttributes, double Milliseconds)
+	{
+		return Milliseconds > 0.0 ? NumAttributes * 1000.0 / Milliseconds : 0.0;
+	}
+
+	/**
+	 * Schema JSON with NumAttributes attributes covering every attribute kind the generator emits.
+	 * WHY: Salt lands in the description so each run hashes differently and the first load really parses.
+	 */
+	static FString MakeSchemaJson(const FString& ClassName, int32 NumAttributes, double DefaultValue, const FString& Salt)
+	{
+		TArray<FString> Attributes;
+		Attributes.Reserve(NumAttributes);
+
+		int32 NumFlags = 0;
+		for (int32 Index = 0; Index < NumAttributes; ++Index)
+		{
+			const FString Name = FString::Printf(TEXT("Attribute%05d"), Index);
+			if (Index % 100 == 99 && NumFlags < 32)
+			{
+				++NumFlags;
+				Attributes.Add(FString::Printf(TEXT("{\"AttributeName\": \"%s\", \"AttributeType\": \"flag\", \"DefaultValue\": 0}"), *Name));
+			}
+			else if (Index % 50 == 49)
+			{
+				Attributes.Add(FString::Printf(TEXT("{\"AttributeName\": \"%s\", \"AttributeType\": \"float\", \"DefaultValue\": %.1f, \"ArraySize\": 4}"), *Name, DefaultValue));
+			}
+			else if (Index % 25 == 24)
+			{
+				Attributes.Add(FString::Printf(
+					TEXT("{\"AttributeName\": \"%s\", \"AttributeType\": \"float\", \"DefaultValue\": %.1f, \"LevelCurve\": [{\"Level\": 1, \"Value\": 10}, {\"Level\": 10, \"Value\": 100}, {\"Level\": 50, \"Value\": 500}]}"),
+					*Name, DefaultValue));
+			}
+			else
+			{
+				Attributes.Add(FString::Printf(
+					TEXT("{\"AttributeName\": \"%s\", \"AttributeType\": \"%s\", \"DefaultValue\": %.1f, \"MinValue\": 0, \"MaxValue\": 1000, \"bReplicates\": true, \"bRepNotify\": %s, \"Description\": \"Synthetic attribute %d\"}"),
+					*Name, Index % 10 == 9 ? TEXT("int32") : TEXT("float"), DefaultValue, Index % 7 == 6 ? TEXT("false") : TEXT("true"), Index));
+			}
+		}
+
+		return FString::Printf(
+			TEXT("{\n  \"SchemaVersion\": 1,\n  \"AttributeSetClassName\": \"%s\",\n  \"TargetModule\": \"GasXRuntime\",\n  \"Description\": \"Generator benchmark %s\",\n  \"Attributes\": [\n    %s\n  ]\n}\n"),
+			*ClassName, *Salt, *FString::Join(Attributes, TEXT(",\n    ")));
+	}
+
+	/** Put developer code after every guarded region, the layout MergeWithExistingFile must preserve. */
+	static FString AddCustomCode(const FString& GeneratedContent)
+	{
+		TArray<FString> Lines;
+		GeneratedContent.ParseIntoArrayLines(Lines, /*bCullEmpty*/ false);
+
+		FString Result;
+		int32 NumRegions = 0;
+		for (const FString& Line : Lines)
+		{
+			Result += Line;
+			Result += TEXT("\n");
+			if (Line.TrimStart().StartsWith(TEXT("//GEN-END:")))
+			{
+				Result += FString::Printf(TEXT("// Custom code %d\nstatic int32 GasXBenchmarkCustom%d = %d;\n"), NumRegions, NumRegions, NumRegions);
+				++NumRegions;
+			}
+		}
+		return Result;
+	}
+
+	static FResult Run(int32 NumAttributes)
+	{
+		FResult Result;
+		Result.NumAttributes = NumAttributes;
+
+		const FString Directory = FPaths::ProjectSavedDir() / TEXT("GasX/Benchmarks/Generator");
+		const FString ClassName = FString::Printf(TEXT("Benchmark%dAttributes"), NumAttributes);
+		const FString SchemaPath = Directory / ClassName + TEXT(".json");
+		const FString HeaderPath = Directory / ClassName + TEXT(".h");
+		const FString SourcePath = Directory / ClassName + TEXT(".cpp");
+
+		FGasXAttributeSetEmitter Emitter;
+
+		// WHY: Existing outputs come from an older version of the schema, so the merge replaces every region's content
+		{
+			FGasXAttributeSetSchema OldSchema;
+			TArray<FGasXSchemaDiagnostic> Diagnostics;
+			if (!FGasXSchemaParser::ParseSchemaString(MakeSchemaJson(ClassName, NumAttributes, 50.0, TEXT("old")), SchemaPath, OldSchema, Diagnostics))
+			{
+				Result.Error = TEXT("Synthetic schema failed to parse");
+				return Result;
+			}
+
+			if (!FFileHelper::SaveStringToFile(AddCustomCode(Emitter.GenerateHeaderContent(OldSchema)), *HeaderPath)
+				|| !FFileHelper::SaveStringToFile(AddCustomCode(Emitter.GenerateSourceContent(OldSchema)), *SourcePath)
+				|| !FFileHelper::SaveStringToFile(MakeSchemaJson(ClassName, NumAttributes, 100.0, FGuid::NewGuid().ToString()), *SchemaPath))
+			{
+				Result.Error = FString::Printf(TEXT("Failed to write benchmark inputs to %s"), *Directory);
+				return Result;
+			}
+		}
+
+		const uint64 BaselineMemory = FPlatformMemory::GetStats().UsedPhysical;
+		uint64 PeakMemory = BaselineMemory;
+		auto SampleMemory = [&PeakMemory]() { PeakMemory = FMath::Max(PeakMemory, FPlatformMemory::GetStats().UsedPhysical); };
+
+		// WHY: The schema content carries a fresh GUID, so the first load misses the cache and writes the entry the second one reads
+		const FString CacheDirectory = FGasXSchemaParser::GetCacheDirectory(FPaths::ProjectSavedDir());
+
+		FGasXAttributeSetSchema Schema;
+		FString Error;
+		double StartTime = FPlatformTime::Seconds();
+		const bool bParsed = FGasXSchemaParser::LoadSchemaFromJson(SchemaPath, Schema, Error, CacheDirectory);
+		Result.ParseMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		SampleMemory();
+		if (!bParsed)
+		{
+			Result.Error = Error;
+			return Result;
+		}
+
+		FGasXAttributeSetSchema CachedSchema;
+		StartTime = FPlatformTime::Seconds();
+		FGasXSchemaParser::LoadSchemaFromJson(SchemaPath, CachedSchema, Error, CacheDirectory);
+		Result.CachedParseMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		const bool bValid = Emitter.ValidateSchema(Schema, Error);
+		Result.ValidateMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		if (!bValid)
+		{
+			Result.Error = Error;
+			return Result;
+		}
+
+		StartTime = FPlatformTime::Seconds();
+		const FString HeaderContent = Emitter.GenerateHeaderContent(Schema);
+		Result.GenerateHeaderMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		SampleMemory();
+
+		StartTime = FPlatformTime::Seconds();
+		const FString SourceContent = Emitter.GenerateSourceContent(Schema);
+		Result.GenerateSourceMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		SampleMemory();
+
+		StartTime = FPlatformTime::Seconds();
+		const FString MergedHeader = Emitter.MergeWithExistingFile(HeaderPath, HeaderContent);
+		const FString MergedSource = Emitter.MergeWithExistingFile(SourcePath, SourceContent);
+		Result.MergeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		SampleMemory();
+
+		if (!MergedHeader.Contains(TEXT("GasXBenchmarkCustom0")) || !MergedSource.Contains(TEXT("GasXBenchmarkCustom0")))
+		{
+			Result.Error = TEXT("Merge dropped custom code between regions");
+			return Result;
+		}
+
+		Result.GeneratedBytes = (MergedHeader.Len() + MergedSource.Len()) * sizeof(TCHAR);
+		Result.PeakMemoryMB = static_cast<double>(PeakMemory - BaselineMemory) / (1024.0 * 1024.0);
+		Result.bSucceeded = true;
+
+		IFileManager::Get().Delete(*SchemaPath);
+		IFileManager::Get().Delete(*HeaderPath);
+		IFileManager::Get().Delete(*SourcePath);
+		return Result;
+	}
+
+	static void AppendCsv(const FResult& Result)
+	{
+		const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("GasX/Benchmarks/GeneratorScaling.csv");
+
+		FString Csv;
+		if (!IFileManager::Get().FileExists(*CsvPath))
+		{
+			Csv += TEXT("Timestamp,Attributes,ParseMs,CachedParseMs,ValidateMs,GenerateHeaderMs,GenerateSourceMs,MergeMs,TotalMs,PerAttributeUs,GeneratedKB,PeakMemoryMB\n");
+		}
+
+		Csv += FString::Printf(TEXT("%s,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f,%.3f\n"),
+			*FDateTime::UtcNow().ToIso8601(), Result.NumAttributes, Result.ParseMs, Result.CachedParseMs, Result.ValidateMs,
+			Result.GenerateHeaderMs, Result.GenerateSourceMs, Result.MergeMs, Result.GetTotalMs(), Result.GetPerAttributeMicroseconds(),
+			Result.GeneratedBytes / 1024.0, Result.PeakMemoryMB);
+
+		FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FGasXGeneratorScalingBenchmark,
+	"GasX.Editor.Benchmark.Generator",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FGasXGeneratorScalingBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumAttributes : {10, 100, 1000, 5000})
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Attributes"), NumAttributes));
+		OutTestCommands.Add(FString::FromInt(NumAttributes));
+	}
+}
+
+bool FGasXGeneratorScalingBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace GasXGeneratorBenchmark;
+
+	const int32 NumAttributes = FCString::Atoi(*Parameters);
+	if (NumAttributes <= 0)
+	{
+		AddError(FString::Printf(TEXT("Malformed benchmark parameters: %s"), *Parameters));
+		return false;
+	}
+
+	const FResult Result = Run(NumAttributes);
+	if (!Result.bSucceeded)
+	{
+		AddError(FString::Printf(TEXT("%d attributes: %s"), NumAttributes, *Result.Error));
+		return false;
+	}
+	AppendCsv(Result);
+
+	AddInfo(FString::Printf(TEXT("%d attributes: parse %.2f ms (cached %.2f ms), validate %.2f ms, header %.2f ms, source %.2f ms, merge %.2f ms (%.1f KB), %.2f us/attribute, peak +%.2f MB"),
+		NumAttributes, Result.ParseMs, Result.CachedParseMs, Result.ValidateMs, Result.GenerateHeaderMs, Result.GenerateSourceMs,
+		Result.MergeMs, Result.GeneratedBytes / 1024.0, Result.GetPerAttributeMicroseconds(), Result.PeakMemoryMB));
+	AddInfo(FString::Printf(TEXT("Throughput (attributes/s): parse %.0f, validate %.0f, header %.0f, source %.0f, merge %.0f"),
+		AttributesPerSecond(NumAttributes, Result.ParseMs), AttributesPerSecond(NumAttributes, Result.ValidateMs),
+		AttributesPerSecond(NumAttributes, Result.GenerateHeaderMs), AttributesPerSecond(NumAttributes, Result.GenerateSourceMs),
+		AttributesPerSecond(NumAttributes, Result.MergeMs)));
+
+	auto CheckThreshold = [this](const TCHAR* Metric, double Value, float Limit)
+	{
+		if (Limit > 0.0f && Value > Limit)
+		{
+			AddError(FString::Printf(TEXT("Regression: %s %.3f exceeds threshold %.3f"), Metric, Value, Limit));
+		}
+	};
+
+	CheckThreshold(TEXT("time per attribute (us)"), Result.GetPerAttributeMicroseconds(), CVarMaxPerAttributeMicroseconds.GetValueOnGameThread());
+	CheckThreshold(TEXT("peak memory (MB)"), Result.PeakMemoryMB, CVarMaxPeakMemoryMB.GetValueOnGameThread());
+
+	// WHY: Absolute times vary by machine; per-attribute cost growing with schema size is what flags an O(n^2) stage
+	const float MaxGrowth = CVarMaxPerAttributeGrowth.GetValueOnGameThread();
+	if (MaxGrowth > 0.0f && NumAttributes > BaselineNumAttributes)
+	{
+		const FResult Baseline = Run(BaselineNumAttributes);
+		if (Baseline.bSucceeded && Baseline.GetPerAttributeMicroseconds() > 0.0)
+		{
+			CheckThreshold(TEXT("per-attribute growth over the 100-attribute run"), Result.GetPerAttributeMicroseconds() / Baseline.GetPerAttributeMicroseconds(), MaxGrowth);
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
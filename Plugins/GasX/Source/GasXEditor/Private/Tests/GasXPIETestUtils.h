@@ -0,0 +1,122 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationCommon.h"
+
+/**
+ * Helpers for automation tests that run a networked single-process PIE session.
+ *
+ * WHY: Replication behaviour (OnReps, late-mapped references, net condition groups) only shows up with a real
+ * net driver; one process with every client as its own PIE world keeps that debuggable and CI friendly.
+ */
+namespace GasXPIETest
+{
+	static constexpr double ConnectTimeoutSeconds = 30.0;
+
+	inline const TCHAR* LexToString(EPlayNetMode NetMode)
+	{
+		return NetMode == PIE_Client ? TEXT("Dedicated") : TEXT("Listen");
+	}
+
+	/**
+	 * Open the test map and request a PIE session over the IP net driver on localhost.
+	 *
+	 * @param NetMode PIE_ListenServer or PIE_Client (dedicated server in the same process)
+	 * @param NumRemoteClients Clients connected over the net driver; a listen server host is added on top
+	 */
+	inline void StartSession(EPlayNetMode NetMode, int32 NumRemoteClients)
+	{
+		ULevelEditorPlaySettings* PlaySettings = NewObject<ULevelEditorPlaySettings>();
+		PlaySettings->SetPlayNetMode(NetMode);
+		// WHY: In PIE_ListenServer the host is one of the PIE players; add it so NumRemoteClients are real connections
+		PlaySettings->SetPlayNumberOfClients(NetMode == PIE_ListenServer ? NumRemoteClients + 1 : NumRemoteClients);
+		PlaySettings->SetRunUnderOneProcess(true);
+		PlaySettings->bLaunchSeparateServer = false;
+
+		FRequestPlaySessionParams Params;
+		Params.WorldType = EPlaySessionWorldType::PlayInEditor;
+		Params.EditorPlaySettings = PlaySettings;
+		Params.DestinationSlateViewport = nullptr;
+
+		AutomationOpenMap(TEXT("/Game/Maps/testmap"));
+		GEditor->RequestPlaySession(Params);
+	}
+
+	/**
+	 * Find the PIE server and client worlds.
+	 *
+	 * @return true once the server has a net driver with NumRemoteClients connections and every client world exists
+	 */
+	inline bool FindWorlds(int32 NumRemoteClients, UWorld*& OutServerWorld, TArray<UWorld*>& OutClientWorlds)
+	{
+		OutServerWorld = nullptr;
+		OutClientWorlds.Reset();
+
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			if (Context.WorldType != EWorldType::PIE || !World)
+			{
+				continue;
+			}
+
+			const ENetMode NetMode = World->GetNetMode();
+			if (NetMode == NM_ListenServer || NetMode == NM_DedicatedServer)
+			{
+				OutServerWorld = World;
+			}
+			else if (NetMode == NM_Client)
+			{
+				OutClientWorlds.Add(World);
+			}
+		}
+
+		return OutServerWorld && OutServerWorld->GetNetDriver() && OutClientWorlds.Num() >= NumRemoteClients
+			&& OutServerWorld->GetNetDriver()->ClientConnections.Num() >= NumRemoteClients;
+	}
+
+	/** Latent command that waits until Condition holds, failing the test if it does not within the timeout. */
+	class FWaitUntilCommand : public IAutomationLatentCommand
+	{
+	public:
+		FWaitUntilCommand(FAutomationTestBase* InTest, const FString& InDescription, TFunction<bool()> InCondition, double InTimeoutSeconds = ConnectTimeoutSeconds)
+			: Test(InTest)
+			, Description(InDescription)
+			, Condition(MoveTemp(InCondition))
+			, TimeoutSeconds(InTimeoutSeconds)
+			, StartTime(FPlatformTime::Seconds())
+		{
+		}
+
+		virtual bool Update() override
+		{
+			if (Condition())
+			{
+				return true;
+			}
+
+			if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
+			{
+				Test->AddError(FString::Printf(TEXT("Timed out: %s"), *Description));
+				return true;
+			}
+			return false;
+		}
+
+	private:
+		FAutomationTestBase* Test;
+		FString Description;
+		TFunction<bool()> Condition;
+		double TimeoutSeconds;
+		double StartTime;
+	};
+}
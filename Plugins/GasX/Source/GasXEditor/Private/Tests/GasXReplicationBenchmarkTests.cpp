@@ -0,0 +1,445 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "Attributes/PlayerCoreAttributes.h"
+#include "EngineUtils.h"
+#include "GasXPIETestUtils.h"
+#include "GasXReplicationLODSubsystem.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tests/GasXTestActors.h"
+
+/**
+ * Loopback replication benchmark for generated attribute sets.
+ *
+ * Starts a single-process PIE session (listen or dedicated server plus N remote clients over the IP net driver on
+ * localhost), spawns replicated actors carrying UPlayerCoreAttributes on the server in a grid around the origin,
+ * drives scripted attribute changes every frame and reports:
+ *   - server bytes per second per actor (total and per connection)
+ *   - server replication flush time per frame (property compare + send)
+ *   - client OnRep count per second (attribute change notifications raised by the generated OnRep_ functions)
+ *   - viewer/set pairs held back by replication LOD at the end of the run
+ * Every config runs with GasX.ReplicationLOD.Enabled at 0 and 1; the actors are always registered with the
+ * replication LOD subsystem (default FGasXReplicationLODSetting), so the two rows differ only by LOD.
+ * Results are appended to Saved/GasX/Benchmarks/ReplicationBandwidth.csv.
+ *
+ * Headless run:
+ *   UnrealEditor-Cmd GasXtension.uproject -ExecCmds="Automation RunTests GasX.Editor.Benchmark.Replication; Quit" -nullrhi -unattended
+ */
+namespace GasXReplicationBenchmark
+{
+	static TAutoConsoleVariable<int32> CVarNumActors(
+		TEXT("GasX.Benchmark.Replication.NumActors"), 100,
+		TEXT("Replicated actors spawned by the replication benchmark"));
+
+	static TAutoConsoleVariable<int32> CVarChangesPerFrame(
+		TEXT("GasX.Benchmark.Replication.ChangesPerFrame"), 1,
+		TEXT("Attributes changed per actor per server frame by the replication benchmark"));
+
+	static TAutoConsoleVariable<float> CVarMeasureSeconds(
+		TEXT("GasX.Benchmark.Replication.MeasureSeconds"), 5.0f,
+		TEXT("Length of the measured window of the replication benchmark"));
+
+	static constexpr double WarmupSeconds = 1.0;
+
+	/** Spacing of the actor grid; with the default 30 m full-rate distance viewers near the origin see a few dozen actors at full rate. */
+	static constexpr double GridSpacing = 1000.0;
+
+	struct FConfig
+	{
+		EPlayNetMode NetMode = PIE_ListenServer;
+		int32 NumClients = 1;
+		bool bReplicationLOD = false;
+	};
+
+	using GasXPIETest::LexToString;
+
+	/** Drives one PIE session through spawn, warm-up and measurement. */
+	class FBenchmarkCommand : public IAutomationLatentCommand
+	{
+	public:
+		FBenchmarkCommand(FAutomationTestBase* InTest, const FConfig& InConfig)
+			: Test(InTest)
+			, Config(InConfig)
+			, NumActors(FMath::Max(1, CVarNumActors.GetValueOnGameThread()))
+			, ChangesPerFrame(FMath::Max(1, CVarChangesPerFrame.GetValueOnGameThread()))
+			, MeasureSeconds(FMath::Max(0.5f, CVarMeasureSeconds.GetValueOnGameThread()))
+			, PhaseStartTime(FPlatformTime::Seconds())
+		{
+			for (TFieldIterator<FProperty> It(UPlayerCoreAttributes::StaticClass()); It; ++It)
+			{
+				if (FGameplayAttribute::IsGameplayAttributeDataProperty(*It))
+				{
+					Attributes.Add(FGameplayAttribute(*It));
+				}
+			}
+		}
+
+		virtual ~FBenchmarkCommand() override
+		{
+			Unbind();
+		}
+
+		static IConsoleVariable* GetLODEnabledCVar()
+		{
+			return IConsoleManager::Get().FindConsoleVariable(TEXT("GasX.ReplicationLOD.Enabled"));
+		}
+
+		virtual bool Update() override
+		{
+			switch (Phase)
+			{
+			case EPhase::WaitForWorlds:
+				if (FindWorlds())
+				{
+					if (IConsoleVariable* LODEnabled = GetLODEnabledCVar())
+					{
+						bPreviousLODEnabled = LODEnabled->GetBool();
+						LODEnabled->Set(Config.bReplicationLOD, ECVF_SetByCode);
+					}
+
+					SpawnServerActors();
+					SetPhase(EPhase::WaitForClients);
+				}
+				return CheckTimeout(TEXT("PIE server and clients did not start"));
+
+			case EPhase::WaitForClients:
+				if (BindClients())
+				{
+					SetPhase(EPhase::Warmup);
+				}
+				return CheckTimeout(TEXT("Clients did not receive every benchmark actor"));
+
+			case EPhase::Warmup:
+				DriveChanges();
+				if (Elapsed() >= WarmupSeconds)
+				{
+					BeginMeasure();
+					SetPhase(EPhase::Measure);
+				}
+				return false;
+
+			case EPhase::Measure:
+				DriveChanges();
+				if (Elapsed() >= MeasureSeconds)
+				{
+					Report();
+					Unbind();
+					return true;
+				}
+				return false;
+			}
+
+			return true;
+		}
+
+	private:
+		enum class EPhase : uint8
+		{
+			WaitForWorlds,
+			WaitForClients,
+			Warmup,
+			Measure
+		};
+
+		void SetPhase(EPhase NewPhase)
+		{
+			Phase = NewPhase;
+			PhaseStartTime = FPlatformTime::Seconds();
+		}
+
+		double Elapsed() const
+		{
+			return FPlatformTime::Seconds() - PhaseStartTime;
+		}
+
+		bool CheckTimeout(const TCHAR* Message)
+		{
+			if (Elapsed() > GasXPIETest::ConnectTimeoutSeconds)
+			{
+				Test->AddError(Message);
+				Unbind();
+				return true;
+			}
+			return false;
+		}
+
+		bool FindWorlds()
+		{
+			UWorld* FoundServerWorld = nullptr;
+			const bool bFound = GasXPIETest::FindWorlds(Config.NumClients, FoundServerWorld, ClientWorlds);
+			ServerWorld = FoundServerWorld;
+			return bFound;
+		}
+
+		void SpawnServerActors()
+		{
+			UGasXReplicationLODSubsystem* ReplicationLOD = ServerWorld->GetSubsystem<UGasXReplicationLODSubsystem>();
+			FGasXReplicationLODSetting LODSetting;
+			LODSetting.AttributeSetClass = UPlayerCoreAttributes::StaticClass();
+
+			const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumActors)));
+			for (int32 Index = 0; Index < NumActors; ++Index)
+			{
+				const FVector Location((Index % GridSize - GridSize / 2) * GridSpacing, (Index / GridSize - GridSize / 2) * GridSpacing, 0.0);
+				AGasXTestASCActor* Actor = ServerWorld->SpawnActor<AGasXTestASCActor>(Location, FRotator::ZeroRotator);
+				Actor->bAlwaysRelevant = true;
+
+				UAbilitySystemComponent* ASC = Actor->GetAbilitySystemComponent();
+				ASC->InitAbilityActorInfo(Actor, Actor);
+				ASC->AddAttributeSetSubobject(NewObject<UPlayerCoreAttributes>(ASC));
+
+				// NOTE: Registered in both LOD rows; with GasX.ReplicationLOD.Enabled=0 every viewer stays in every group
+				if (ReplicationLOD)
+				{
+					ReplicationLOD->RegisterActor(Actor, ASC, MakeArrayView(&LODSetting, 1));
+				}
+
+				ServerASCs.Add(ASC);
+			}
+
+			PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FBenchmarkCommand::OnPostActorTick);
+			// WHY: Registered after the net driver's own TickFlush binding, so this fires once replication is done
+			TickFlushHandle = ServerWorld->OnTickFlush().AddRaw(this, &FBenchmarkCommand::OnTickFlush);
+		}
+
+		bool BindClients()
+		{
+			TArray<UAbilitySystemComponent*> ReadyASCs;
+			for (UWorld* ClientWorld : ClientWorlds)
+			{
+				int32 NumReplicated = 0;
+				for (TActorIterator<AActor> It(ClientWorld); It; ++It)
+				{
+					UAbilitySystemComponent* ASC = It->FindComponentByClass<UAbilitySystemComponent>();
+					if (ASC && ASC->GetSet<UPlayerCoreAttributes>())
+					{
+						ReadyASCs.Add(ASC);
+						++NumReplicated;
+					}
+				}
+
+				if (NumReplicated < NumActors)
+				{
+					return false;
+				}
+			}
+
+			for (UAbilitySystemComponent* ASC : ReadyASCs)
+			{
+				for (const FGameplayAttribute& Attribute : Attributes)
+				{
+					FDelegateHandle Handle = ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddRaw(this, &FBenchmarkCommand::OnClientAttributeChanged);
+					ClientBindings.Add({ASC, Attribute, Handle});
+				}
+			}
+
+			return true;
+		}
+
+		void DriveChanges()
+		{
+			++Frame;
+			for (int32 ActorIndex = 0; ActorIndex < ServerASCs.Num(); ++ActorIndex)
+			{
+				UAbilitySystemComponent* ASC = ServerASCs[ActorIndex].Get();
+				if (!ASC)
+				{
+					continue;
+				}
+
+				for (int32 Change = 0; Change < ChangesPerFrame; ++Change)
+				{
+					const FGameplayAttribute& Attribute = Attributes[(ActorIndex + Change + Frame) % Attributes.Num()];
+					ASC->SetNumericAttributeBase(Attribute, static_cast<float>((Frame + ActorIndex) % 100));
+				}
+			}
+		}
+
+		void BeginMeasure()
+		{
+			MeasureStartBytes = ServerWorld->GetNetDriver()->OutTotalBytes;
+			FlushSeconds = 0.0;
+			NumFlushes = 0;
+			NumClientOnReps = 0;
+			bMeasuring = true;
+		}
+
+		void OnPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+		{
+			if (World == ServerWorld)
+			{
+				FlushStartTime = FPlatformTime::Seconds();
+			}
+		}
+
+		void OnTickFlush(float DeltaSeconds)
+		{
+			if (bMeasuring && FlushStartTime > 0.0)
+			{
+				FlushSeconds += FPlatformTime::Seconds() - FlushStartTime;
+				++NumFlushes;
+			}
+			FlushStartTime = 0.0;
+		}
+
+		void OnClientAttributeChanged(const FOnAttributeChangeData& ChangeData)
+		{
+			if (bMeasuring)
+			{
+				++NumClientOnReps;
+			}
+		}
+
+		void Report()
+		{
+			bMeasuring = false;
+
+			UNetDriver* NetDriver = ServerWorld->GetNetDriver();
+			const double Duration = Elapsed();
+			const int32 NumConnections = FMath::Max(1, NetDriver->ClientConnections.Num());
+			const double BytesPerSecondPerActor = static_cast<double>(NetDriver->OutTotalBytes - MeasureStartBytes) / Duration / NumActors;
+			const double FlushMsPerFrame = NumFlushes > 0 ? FlushSeconds * 1000.0 / NumFlushes : 0.0;
+			const double OnRepsPerClientPerSecond = static_cast<double>(NumClientOnReps) / FMath::Max(1, ClientWorlds.Num()) / Duration;
+			const UGasXReplicationLODSubsystem* ReplicationLOD = ServerWorld->GetSubsystem<UGasXReplicationLODSubsystem>();
+			const int32 NumThrottledPairs = ReplicationLOD ? ReplicationLOD->GetNumThrottledPairs() : 0;
+
+			Test->AddInfo(FString::Printf(TEXT("%s server, %d client(s), %d actors, LOD %s: %.1f B/s per actor (%.1f per connection), flush %.3f ms/frame, %.1f OnReps/s per client, %d throttled viewer/set pair(s)"),
+				LexToString(Config.NetMode), Config.NumClients, NumActors, Config.bReplicationLOD ? TEXT("on") : TEXT("off"), BytesPerSecondPerActor, BytesPerSecondPerActor / NumConnections,
+				FlushMsPerFrame, OnRepsPerClientPerSecond, NumThrottledPairs));
+
+			const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("GasX/Benchmarks/ReplicationBandwidth.csv");
+			FString Csv;
+			if (!IFileManager::Get().FileExists(*CsvPath))
+			{
+				Csv += TEXT("Timestamp,Server,Clients,Actors,ChangesPerFrame,BytesPerSecondPerActor,BytesPerSecondPerActorPerConnection,FlushMsPerFrame,OnRepsPerSecondPerClient,ReplicationLOD,ThrottledPairs\n");
+			}
+			Csv += FString::Printf(TEXT("%s,%s,%d,%d,%d,%.3f,%.3f,%.4f,%.3f,%d,%d\n"),
+				*FDateTime::UtcNow().ToIso8601(), LexToString(Config.NetMode), Config.NumClients, NumActors, ChangesPerFrame,
+				BytesPerSecondPerActor, BytesPerSecondPerActor / NumConnections, FlushMsPerFrame, OnRepsPerClientPerSecond,
+				Config.bReplicationLOD ? 1 : 0, NumThrottledPairs);
+			FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+		}
+
+		void Unbind()
+		{
+			bMeasuring = false;
+
+			for (const FClientBinding& Binding : ClientBindings)
+			{
+				if (UAbilitySystemComponent* ASC = Binding.ASC.Get())
+				{
+					ASC->GetGameplayAttributeValueChangeDelegate(Binding.Attribute).Remove(Binding.Handle);
+				}
+			}
+			ClientBindings.Reset();
+
+			FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+			PostActorTickHandle.Reset();
+
+			if (ServerWorld.IsValid())
+			{
+				ServerWorld->OnTickFlush().Remove(TickFlushHandle);
+			}
+			TickFlushHandle.Reset();
+
+			if (bPreviousLODEnabled.IsSet())
+			{
+				if (IConsoleVariable* LODEnabled = GetLODEnabledCVar())
+				{
+					LODEnabled->Set(bPreviousLODEnabled.GetValue(), ECVF_SetByCode);
+				}
+				bPreviousLODEnabled.Reset();
+			}
+		}
+
+		struct FClientBinding
+		{
+			TWeakObjectPtr<UAbilitySystemComponent> ASC;
+			FGameplayAttribute Attribute;
+			FDelegateHandle Handle;
+		};
+
+		FAutomationTestBase* Test;
+		FConfig Config;
+		int32 NumActors;
+		int32 ChangesPerFrame;
+		float MeasureSeconds;
+
+		EPhase Phase = EPhase::WaitForWorlds;
+		double PhaseStartTime;
+		int32 Frame = 0;
+
+		TArray<FGameplayAttribute> Attributes;
+		TWeakObjectPtr<UWorld> ServerWorld;
+		TArray<UWorld*> ClientWorlds;
+		TArray<TWeakObjectPtr<UAbilitySystemComponent>> ServerASCs;
+		TArray<FClientBinding> ClientBindings;
+
+		FDelegateHandle PostActorTickHandle;
+		FDelegateHandle TickFlushHandle;
+
+		TOptional<bool> bPreviousLODEnabled;
+		bool bMeasuring = false;
+		uint64 MeasureStartBytes = 0;
+		double FlushStartTime = 0.0;
+		double FlushSeconds = 0.0;
+		int32 NumFlushes = 0;
+		int64 NumClientOnReps = 0;
+	};
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FGasXReplicationBandwidthBenchmark,
+	"GasX.Editor.Benchmark.Replication",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FGasXReplicationBandwidthBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	using namespace GasXReplicationBenchmark;
+
+	for (const EPlayNetMode NetMode : {PIE_ListenServer, PIE_Client})
+	{
+		for (const int32 NumClients : {1, 4})
+		{
+			for (const bool bReplicationLOD : {false, true})
+			{
+				OutBeautifiedNames.Add(FString::Printf(TEXT("%s %d Clients LOD %s"), LexToString(NetMode), NumClients, bReplicationLOD ? TEXT("On") : TEXT("Off")));
+				OutTestCommands.Add(FString::Printf(TEXT("%d %d %d"), static_cast<int32>(NetMode), NumClients, bReplicationLOD ? 1 : 0));
+			}
+		}
+	}
+}
+
+bool FGasXReplicationBandwidthBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace GasXReplicationBenchmark;
+
+	TArray<FString> Tokens;
+	Parameters.ParseIntoArrayWS(Tokens);
+	if (Tokens.Num() != 3 || !GEditor)
+	{
+		AddError(FString::Printf(TEXT("Malformed benchmark parameters or no editor: %s"), *Parameters));
+		return false;
+	}
+
+	FConfig Config;
+	Config.NetMode = static_cast<EPlayNetMode>(FCString::Atoi(*Tokens[0]));
+	Config.NumClients = FMath::Max(1, FCString::Atoi(*Tokens[1]));
+	Config.bReplicationLOD = FCString::Atoi(*Tokens[2]) != 0;
+
+	// WHY: One process, real IP net driver over localhost; every client is its own PIE world
+	GasXPIETest::StartSession(Config.NetMode, Config.NumClients);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FBenchmarkCommand(this, Config));
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand());
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
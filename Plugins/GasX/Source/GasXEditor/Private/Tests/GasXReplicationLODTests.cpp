@@ -0,0 +1,239 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "Attributes/PlayerCoreAttributes.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GasXPIETestUtils.h"
+#include "GasXReplicationLODSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "Tests/GasXTestActors.h"
+
+/**
+ * Replication LOD group membership in a dedicated server PIE session with three remote viewers:
+ * the owner and a far viewer are moved away from the actor, a near viewer stays next to it.
+ */
+namespace GasXReplicationLODTest
+{
+	static constexpr int32 NumViewers = 3;
+	static constexpr double FarDistance = 200000.0;
+
+	struct FState
+	{
+		TWeakObjectPtr<UWorld> ServerWorld;
+		TWeakObjectPtr<APlayerController> OwnerViewer;
+		TWeakObjectPtr<APlayerController> NearViewer;
+		TWeakObjectPtr<APlayerController> FarViewer;
+		TOptional<bool> bPreviousLODEnabled;
+	};
+
+	static IConsoleVariable* GetLODEnabledCVar()
+	{
+		return IConsoleManager::Get().FindConsoleVariable(TEXT("GasX.ReplicationLOD.Enabled"));
+	}
+
+	static FVector GetViewLocation(const TWeakObjectPtr<APlayerController>& Viewer)
+	{
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation;
+		if (Viewer.IsValid())
+		{
+			Viewer->GetPlayerViewPoint(Location, Rotation);
+		}
+		return Location;
+	}
+
+	static bool FindViewers(FState& State)
+	{
+		UWorld* ServerWorld = nullptr;
+		TArray<UWorld*> ClientWorlds;
+		if (!GasXPIETest::FindWorlds(NumViewers, ServerWorld, ClientWorlds))
+		{
+			return false;
+		}
+
+		TArray<APlayerController*> Viewers;
+		for (FConstPlayerControllerIterator It = ServerWorld->GetPlayerControllerIterator(); It; ++It)
+		{
+			APlayerController* PlayerController = It->Get();
+			if (PlayerController && !PlayerController->IsLocalController() && PlayerController->GetPawn())
+			{
+				Viewers.Add(PlayerController);
+			}
+		}
+
+		if (Viewers.Num() < NumViewers)
+		{
+			return false;
+		}
+
+		State.ServerWorld = ServerWorld;
+		State.OwnerViewer = Viewers[0];
+		State.NearViewer = Viewers[1];
+		State.FarViewer = Viewers[2];
+		return true;
+	}
+
+	static void Cleanup(FState& State)
+	{
+		if (State.bPreviousLODEnabled.IsSet())
+		{
+			if (IConsoleVariable* LODEnabled = GetLODEnabledCVar())
+			{
+				LODEnabled->Set(State.bPreviousLODEnabled.GetValue(), ECVF_SetByCode);
+			}
+			State.bPreviousLODEnabled.Reset();
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXReplicationLODGroupMembershipTest,
+	"GasX.Editor.ReplicationLOD.GroupMembership",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXReplicationLODGroupMembershipTest::RunTest(const FString& Parameters)
+{
+	using namespace GasXReplicationLODTest;
+
+	if (!GEditor)
+	{
+		AddError(TEXT("Requires the editor"));
+		return false;
+	}
+
+	// WHY: Dedicated server so every viewer is a remote connection; local controllers are never bucketed
+	GasXPIETest::StartSession(PIE_Client, NumViewers);
+
+	TSharedRef<FState> State = MakeShared<FState>();
+
+	ADD_LATENT_AUTOMATION_COMMAND(GasXPIETest::FWaitUntilCommand(this, TEXT("PIE server with three possessed remote viewers"), [State]()
+	{
+		return FindViewers(*State);
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		if (HasAnyErrors())
+		{
+			return true;
+		}
+
+		if (IConsoleVariable* LODEnabled = GetLODEnabledCVar())
+		{
+			State->bPreviousLODEnabled = LODEnabled->GetBool();
+			LODEnabled->Set(true, ECVF_SetByCode);
+		}
+
+		// Owner and far viewer leave; the near viewer stays where it spawned
+		const FVector NearLocation = GetViewLocation(State->NearViewer);
+		State->OwnerViewer->GetPawn()->SetActorLocation(NearLocation + FVector(FarDistance, 0.0, 0.0), false, nullptr, ETeleportType::TeleportPhysics);
+		State->FarViewer->GetPawn()->SetActorLocation(NearLocation - FVector(FarDistance, 0.0, 0.0), false, nullptr, ETeleportType::TeleportPhysics);
+		return true;
+	}));
+
+	// NOTE: The server sees remote view points through the clients' camera updates, so wait for them to follow
+	ADD_LATENT_AUTOMATION_COMMAND(GasXPIETest::FWaitUntilCommand(this, TEXT("Remote view points follow the moved pawns"), [this, State]()
+	{
+		const FVector NearLocation = GetViewLocation(State->NearViewer);
+		return HasAnyErrors()
+			|| (FVector::Dist(GetViewLocation(State->OwnerViewer), NearLocation) > FarDistance * 0.5
+				&& FVector::Dist(GetViewLocation(State->FarViewer), NearLocation) > FarDistance * 0.5);
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		UWorld* ServerWorld = State->ServerWorld.Get();
+		UGasXReplicationLODSubsystem* ReplicationLOD = ServerWorld ? ServerWorld->GetSubsystem<UGasXReplicationLODSubsystem>() : nullptr;
+		if (HasAnyErrors() || !TestNotNull(TEXT("Replication LOD subsystem on the server"), ReplicationLOD))
+		{
+			Cleanup(*State);
+			return true;
+		}
+
+		APlayerController* OwnerViewer = State->OwnerViewer.Get();
+		APlayerController* NearViewer = State->NearViewer.Get();
+		APlayerController* FarViewer = State->FarViewer.Get();
+
+		AGasXTestASCActor* Actor = ServerWorld->SpawnActor<AGasXTestASCActor>(GetViewLocation(State->NearViewer), FRotator::ZeroRotator);
+		Actor->SetOwner(OwnerViewer);
+		// WHY: A slow owner (2 Hz) makes the far refresh window outlast several evaluations
+		Actor->SetNetUpdateFrequency(2.0f);
+
+		UAbilitySystemComponent* ASC = Actor->GetAbilitySystemComponent();
+		ASC->InitAbilityActorInfo(Actor, Actor);
+		UPlayerCoreAttributes* Set = NewObject<UPlayerCoreAttributes>(ASC);
+		ASC->AddAttributeSetSubobject(Set);
+
+		FGasXReplicationLODSetting Setting;
+		Setting.AttributeSetClass = UPlayerCoreAttributes::StaticClass();
+		Setting.FullRateDistance = 1000.0f;
+		Setting.FarUpdateInterval = 5.0f;
+		ReplicationLOD->RegisterActor(Actor, ASC, MakeArrayView(&Setting, 1));
+
+		// NOTE: RegisterActor evaluated at or before Now, opening the far viewer's first refresh
+		const double Now = ServerWorld->GetTimeSeconds();
+		const FName NetGroup = ReplicationLOD->GetNetGroup(Set);
+		if (TestNotEqual(TEXT("Set is under LOD"), NetGroup, FName(NAME_None)))
+		{
+			TestTrue(TEXT("Owner is in the group"), OwnerViewer->IsMemberOfNetConditionGroup(NetGroup));
+			TestTrue(TEXT("Near viewer is in the group"), NearViewer->IsMemberOfNetConditionGroup(NetGroup));
+			TestTrue(TEXT("Far viewer gets its first refresh"), FarViewer->IsMemberOfNetConditionGroup(NetGroup));
+
+			ReplicationLOD->Evaluate(Now + 0.25);
+			TestTrue(TEXT("Far refresh stays open for the owner's net update period"), FarViewer->IsMemberOfNetConditionGroup(NetGroup));
+
+			ReplicationLOD->Evaluate(Now + 0.75);
+			TestFalse(TEXT("Far viewer leaves once the refresh window closes"), FarViewer->IsMemberOfNetConditionGroup(NetGroup));
+			TestTrue(TEXT("Owner stays in regardless of distance"), OwnerViewer->IsMemberOfNetConditionGroup(NetGroup));
+			TestTrue(TEXT("Near viewer stays in"), NearViewer->IsMemberOfNetConditionGroup(NetGroup));
+			TestEqual(TEXT("Only the far viewer is throttled"), ReplicationLOD->GetNumThrottledPairs(), 1);
+
+			ReplicationLOD->Evaluate(Now + 5.25);
+			TestTrue(TEXT("Far viewer refreshed after FarUpdateInterval"), FarViewer->IsMemberOfNetConditionGroup(NetGroup));
+
+			if (IConsoleVariable* LODEnabled = GetLODEnabledCVar())
+			{
+				LODEnabled->Set(false, ECVF_SetByCode);
+				ReplicationLOD->Evaluate(Now + 6.0);
+				TestTrue(TEXT("Disabled LOD keeps every viewer in"), FarViewer->IsMemberOfNetConditionGroup(NetGroup));
+				TestEqual(TEXT("Disabled LOD throttles nothing"), ReplicationLOD->GetNumThrottledPairs(), 0);
+			}
+
+			// WHY: Group names come from a pool, so respawns do not mint new ones
+			ReplicationLOD->UnregisterActor(Actor);
+			TestFalse(TEXT("Unregistering leaves the group"), FarViewer->IsMemberOfNetConditionGroup(NetGroup));
+			ReplicationLOD->RegisterActor(Actor, ASC, MakeArrayView(&Setting, 1));
+			TestEqual(TEXT("Released group name is reused"), ReplicationLOD->GetNetGroup(Set), NetGroup);
+
+			// WHY: With no far interval a far viewer still needs one refresh, or its client never gets the set at all
+			if (IConsoleVariable* LODEnabled = GetLODEnabledCVar())
+			{
+				LODEnabled->Set(true, ECVF_SetByCode);
+			}
+			ReplicationLOD->UnregisterActor(Actor);
+			Setting.FarUpdateInterval = 0.0f;
+			ReplicationLOD->RegisterActor(Actor, ASC, MakeArrayView(&Setting, 1));
+			const double InitialOnlyNow = ServerWorld->GetTimeSeconds();
+			const FName InitialOnlyGroup = ReplicationLOD->GetNetGroup(Set);
+			TestTrue(TEXT("Zero interval still sends the first refresh"), FarViewer->IsMemberOfNetConditionGroup(InitialOnlyGroup));
+			ReplicationLOD->Evaluate(InitialOnlyNow + 0.75);
+			TestFalse(TEXT("Zero interval closes after the first refresh"), FarViewer->IsMemberOfNetConditionGroup(InitialOnlyGroup));
+			ReplicationLOD->Evaluate(InitialOnlyNow + 60.0);
+			TestFalse(TEXT("Zero interval sends no further refreshes"), FarViewer->IsMemberOfNetConditionGroup(InitialOnlyGroup));
+		}
+
+		ReplicationLOD->UnregisterActor(Actor);
+		Actor->Destroy();
+		Cleanup(*State);
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand());
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -3,7 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GasXAttributeDefinition.h"
+#include "GasXAttributeSetEmitter.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UPackage;
 
 /**
  * Generates C++ AttributeSet classes from FGasXAttributeSetSchema definitions.
@@ -11,6 +14,8 @@
  * WHY: Automates the repetitive and error-prone task of writing AttributeSet boilerplate,
  * ensuring consistency with Epic's GAS patterns and replication rules.
  * 
+ * C++ text comes from FGasXAttributeSetEmitter (GasXCodeGen); this class adds the metadata and curve assets.
+ * 
  * NOTE: This is editor-only code. Runtime uses generated classes, never the generator itself.
  */
 class GASXEDITOR_API FGasXAttributeSetGenerator
@@ -29,79 +34,56 @@ public:
 		const FString& OutputHeaderPath,
 		const FString& OutputSourcePath);
 
-private:
-	/**
-	 * Validate that a schema is well-formed before generation.
-	 * WHY: Fail fast on empty names, duplicates, invalid identifiers, or reserved keywords.
-	 */
-	bool ValidateSchema(const FGasXAttributeSetSchema& Schema, FString& OutError) const;
-
-	/**
-	 * Generate the header file content for an AttributeSet.
-	 */
-	FString GenerateHeaderContent(const FGasXAttributeSetSchema& Schema) const;
-
-	/**
-	 * Generate the implementation file content for an AttributeSet.
-	 */
-	FString GenerateSourceContent(const FGasXAttributeSetSchema& Schema) const;
-
-	/**
-	 * Generate a single attribute property declaration with replication setup.
-	 */
-	FString GenerateAttributeProperty(const FGasXAttributeDefinition& Attribute) const;
-
-	/**
-	 * Generate OnRep function declaration for a single attribute.
-	 */
-	FString GenerateOnRepDeclaration(const FGasXAttributeDefinition& Attribute) const;
-
-	/**
-	 * Generate accessor macros for a single attribute.
-	 */
-	FString GenerateAccessors(const FGasXAttributeDefinition& Attribute, const FString& ClassName) const;
-
 	/**
-	 * Generate OnRep implementation that broadcasts the attribute change.
-	 */
-	FString GenerateOnRepImplementation(const FGasXAttributeDefinition& Attribute, const FString& ClassName) const;
-
-	/**
-	 * Generate replication setup for all attributes.
-	 */
-	FString GenerateReplicationSetup(const FGasXAttributeSetSchema& Schema) const;
-
-	/**
-	 * Ensure the output directory exists.
-	 */
-	bool EnsureOutputDirectory(const FString& DirectoryPath) const;
-
-	/**
-	 * Check if a name is a reserved C++ keyword.
+	 * Save every asset package dirtied since the last call in one batch.
+	 * WHY: Batch runs generate many schemas; saving once at the end avoids per-asset checkout and save overhead.
+	 * 
+	 * @return true if all packages saved (or nothing needed saving)
 	 */
-	bool IsReservedKeyword(const FString& Name) const;
+	bool SavePendingPackages();
 
 	/**
-	 * Check if a name is a valid C++ identifier.
+	 * If true, GenerateAttributeSet leaves dirtied asset packages queued for SavePendingPackages()
+	 * instead of saving them itself. Set this when generating several schemas in one run.
 	 */
-	bool IsValidIdentifier(const FString& Name) const;
+	bool bDeferPackageSaves = false;
 
 	/**
-	 * Merge new generated content with existing file while preserving custom code outside guarded regions.
-	 * WHY: Allows incremental regeneration without losing developer customizations.
+	 * Compute what GenerateAttributeSet would write without touching disk.
+	 * WHY: Lets batch runs verify that checked-in generated code is up to date with its schema.
+	 * 
+	 * @param Schema The attribute definition schema
+	 * @param OutputHeaderPath Full path of the .h file that would be written
+	 * @param OutputSourcePath Full path of the .cpp file that would be written
+	 * @param OutOutOfDateFiles Receives every output path whose merged content differs from disk
+	 * @param OutError Validation error if the schema cannot be generated
+	 * @return true if the schema is valid and the comparison ran; false on error
 	 */
-	FString MergeWithExistingFile(const FString& FilePath, const FString& NewGeneratedContent) const;
+	bool CollectOutOfDateFiles(
+		const FGasXAttributeSetSchema& Schema,
+		const FString& OutputHeaderPath,
+		const FString& OutputSourcePath,
+		TArray<FString>& OutOutOfDateFiles,
+		FString& OutError) const;
 
 	/**
-	 * Replace guarded regions inside the existing file with the freshly generated versions.
-	 * WHY: Preserve developer code outside guarded regions while still updating generated blocks.
+	 * Resolve the header and source paths a schema generates into, following the plugin's module layout.
+	 * WHY: The console command and schema watch mode must agree on where generated files live.
+	 * 
+	 * @param Schema The attribute definition schema
+	 * @param OutHeaderPath Full path of the generated .h file
+	 * @param OutSourcePath Full path of the generated .cpp file
 	 */
-	FString ReplaceGuardedRegions(const FString& ExistingContent, const FString& NewContent) const;
+	static void ResolveOutputPaths(const FGasXAttributeSetSchema& Schema, FString& OutHeaderPath, FString& OutSourcePath);
 
+private:
 	/**
-	 * Generate a UDataTable asset containing metadata rows for each attribute in the schema.
+	 * Create or update the UDataTable asset containing metadata rows for each attribute in the schema.
 	 * WHY: Enables designers to adjust default values, min/max, and descriptions without touching C++ or JSON.
 	 * 
+	 * An existing table is updated in place: rows are added, updated or removed only where the schema changed,
+	 * and fields a designer edited since the last generation are kept. The package is only dirtied if something changed.
+	 * 
 	 * @param Schema The attribute definition schema
 	 * @param OutputAssetPath Full content path where the DataTable asset should be created (e.g. /Game/Generated/Attributes/PlayerCoreMetadata)
 	 * @return true if DataTable creation succeeded; false on error
@@ -109,12 +91,20 @@ private:
 	bool GenerateMetadataTable(const FGasXAttributeSetSchema& Schema, const FString& OutputAssetPath);
 
 	/**
-	 * Generate a UGameplayEffect asset for initializing attributes with values from the schema or DataTable.
-	 * WHY: Provides data-driven attribute initialization compatible with GasXBootstrap toggle system.
+	 * Create or update the UCurveTable holding one linear rich curve per attribute that declares a LevelCurve.
+	 * WHY: Level-scaled defaults stay data-driven; the runtime pre-samples the curves into per-level arrays.
 	 * 
 	 * @param Schema The attribute definition schema
-	 * @param OutputAssetPath Full content path where the GameplayEffect asset should be created (e.g. /Game/Generated/Attributes/GE_InitPlayerCore)
-	 * @return true if GameplayEffect creation succeeded; false on error
+	 * @param OutputAssetPath Full content path of the CurveTable asset (e.g. /Game/Generated/Attributes/PlayerCoreAttributesCurves)
+	 * @return true if the CurveTable is up to date; false on error
 	 */
-	bool GenerateInitGameplayEffect(const FGasXAttributeSetSchema& Schema, const FString& OutputAssetPath);
+	bool GenerateLevelCurveTable(const FGasXAttributeSetSchema& Schema, const FString& OutputAssetPath);
+
+	/** Remember a dirtied asset package for the next SavePendingPackages(). */
+	void QueuePackageSave(UPackage* Package);
+
+	/** Packages dirtied by asset generation that have not been saved yet. */
+	TArray<TWeakObjectPtr<UPackage>> PendingPackageSaves;
+
+	FGasXAttributeSetEmitter Emitter;
 };
@@ -3,12 +3,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+class FGasXSchemaWatcher;
 
 /**
  * Editor console commands for GasX AttributeSet generation.
  * 
  * Usage in Editor:
  * GasX.GenerateAttributeSet <SchemaJsonPath>
+ * GasX.WatchSchemas [SchemaDirectory...]
+ * GasX.UnwatchSchemas
+ * GasX.BakeAttributeDefaults
  * 
  * Example:
  * GasX.GenerateAttributeSet "D:/Documents/GasXtension/Plugins/GasX/Schemas/Attributes/PlayerCoreAttributes.json"
@@ -21,6 +27,15 @@ public:
 
 private:
 	static void GenerateAttributeSetCommand(const TArray<FString>& Args);
+	static void WatchSchemasCommand(const TArray<FString>& Args);
+	static void UnwatchSchemasCommand(const TArray<FString>& Args);
+	static void BakeAttributeDefaultsCommand(const TArray<FString>& Args);
 	
 	static FAutoConsoleCommand GenerateAttributeSetCmd;
+	static FAutoConsoleCommand WatchSchemasCmd;
+	static FAutoConsoleCommand UnwatchSchemasCmd;
+	static FAutoConsoleCommand BakeAttributeDefaultsCmd;
+
+	/** Active schema watcher, if watch mode has been started. */
+	static TUniquePtr<FGasXSchemaWatcher> SchemaWatcher;
 };
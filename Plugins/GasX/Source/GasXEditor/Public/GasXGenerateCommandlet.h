@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GasXGenerateExitCode.h"
+#include "GasXGenerateCommandlet.generated.h"
+
+/**
+ * Headless batch generation of AttributeSets from JSON schemas.
+ *
+ * WHY: Booting the interactive editor just to run GasX.GenerateAttributeSet takes minutes on
+ * build machines. The commandlet runs the same parser and generator under -nullrhi -unattended.
+ *
+ * Usage:
+ * UnrealEditor-Cmd GasXtension.uproject -run=GasXGenerate -Schemas="Plugins/GasX/Schemas/Attributes/*.json" [-Verify] [-CodeOnly] [-NoSchemaCache] -nullrhi -unattended
+ *
+ * -Schemas   File glob relative to the project directory. A trailing "**" directory searches recursively.
+ * -Verify    Dry run: report generated files that are out of date with their schema without writing anything.
+ * -CodeOnly  Skip metadata DataTable asset generation.
+ * -NoSchemaCache  Always re-parse schemas instead of using the content-hash parse cache.
+ *
+ * Exit codes: see EGasXGenerateExitCode.
+ */
+UCLASS()
+class GASXEDITOR_API UGasXGenerateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGasXGenerateCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
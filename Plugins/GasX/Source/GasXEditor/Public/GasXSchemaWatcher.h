@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GasXAttributeDefinition.h"
+#include "GasXSchemaGraph.h"
+
+struct FFileChangeData;
+class FGasXAttributeSetGenerator;
+
+/**
+ * Watches schema directories and regenerates AttributeSets when their JSON files change.
+ *
+ * WHY: Designers iterate on schemas constantly; running GasX.GenerateAttributeSet by hand
+ * after every save is slow and easy to forget.
+ *
+ * Bursts of change events (editors often write a file several times per save) are collected
+ * and flushed once the directory has been quiet for DebounceSeconds. Only the schemas that
+ * changed, plus the schemas that Extend or Include them, are regenerated through the same
+ * guarded-region merge as the console command.
+ */
+class GASXEDITOR_API FGasXSchemaWatcher
+{
+public:
+	FGasXSchemaWatcher();
+	~FGasXSchemaWatcher();
+
+	/**
+	 * Begin watching the given directories for *.json changes.
+	 *
+	 * @param Directories Absolute directory paths to watch (recursively)
+	 * @return true if at least one directory was registered with the DirectoryWatcher
+	 */
+	bool Start(const TArray<FString>& Directories);
+
+	/** Stop watching all directories and drop any pending, not yet flushed changes. */
+	void Stop();
+
+	bool IsWatching() const { return WatchedDirectories.Num() > 0; }
+
+	/** Default schema directory watched when no explicit directory is given. */
+	static FString GetDefaultSchemaDirectory();
+
+	/** Quiet period after the last change event before regeneration runs. */
+	float DebounceSeconds = 0.3f;
+
+private:
+	void OnDirectoryChanged(const TArray<FFileChangeData>& FileChanges);
+
+	bool Tick(float DeltaTime);
+
+	/** Regenerate every pending schema and report the outcome as an editor notification. */
+	void FlushPendingSchemas();
+
+	/** Generate one parsed schema. Returns false with a reason on failure. */
+	bool RegenerateSchema(FGasXAttributeSetGenerator& Generator, const FGasXAttributeSetSchema& Schema, FString& OutError) const;
+
+	void ShowNotification(const FText& Message, bool bSuccess) const;
+
+	struct FWatchedDirectory
+	{
+		FString Path;
+		FDelegateHandle Handle;
+	};
+
+	TArray<FWatchedDirectory> WatchedDirectories;
+
+	/** Every schema under the watched directories, kept resolved between flushes. */
+	FGasXSchemaGraph Graph;
+
+	/** Schema files changed since the last flush. */
+	TSet<FString> PendingSchemas;
+
+	/** Platform time of the most recent change event. */
+	double LastChangeTime = 0.0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
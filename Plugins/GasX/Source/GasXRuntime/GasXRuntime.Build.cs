@@ -8,11 +8,17 @@ public class GasXRuntime : ModuleRules
 
         PublicDependencyModuleNames.AddRange(new[]
         {
-            "Core", "CoreUObject", "Engine",
+            "Core", "CoreUObject", "Engine", "NetCore",
             "GameplayAbilities", "GameplayTags",
             "GameFeatures", "ModularGameplay"
         });
 
+        // WHY: Baked attribute defaults discover metadata tables through the asset registry when cooking
+        if (Target.bBuildEditor)
+        {
+            PrivateDependencyModuleNames.Add("AssetRegistry");
+        }
+
         // WHY: Enable automation tests in Development builds for editor testing
         if (Target.Configuration != UnrealTargetConfiguration.Shipping)
         {
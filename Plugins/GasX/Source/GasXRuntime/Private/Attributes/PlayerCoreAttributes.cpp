@@ -3,6 +3,8 @@
 
 #include "Attributes/PlayerCoreAttributes.h"
 #include "Net/UnrealNetwork.h"
+#include "GasXInitAttributeRegistry.h"
+#include "NativeGameplayTags.h"
 
 UPlayerCoreAttributes::UPlayerCoreAttributes()
 {
@@ -11,12 +13,13 @@ UPlayerCoreAttributes::UPlayerCoreAttributes()
 	Health.SetCurrentValue(100.00f);
 	MaxHealth.SetBaseValue(100.00f);
 	MaxHealth.SetCurrentValue(100.00f);
-	Stamina.SetBaseValue(100.00f);
-	Stamina.SetCurrentValue(100.00f);
 	Mana.SetBaseValue(50.00f);
 	Mana.SetCurrentValue(50.00f);
+	Stamina.SetBaseValue(100.00f);
+	Stamina.SetCurrentValue(100.00f);
 	Energy.SetBaseValue(50.00f);
 	Energy.SetCurrentValue(50.00f);
+	InitFlagBits(0x0000000000000000ull);
 	//GEN-END: Constructor Initialization
 }
 
@@ -33,14 +36,14 @@ void UPlayerCoreAttributes::OnRep_MaxHealth(const FGameplayAttributeData& OldVal
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UPlayerCoreAttributes, MaxHealth, OldValue);
 }
 
-void UPlayerCoreAttributes::OnRep_Stamina(const FGameplayAttributeData& OldValue)
+void UPlayerCoreAttributes::OnRep_Mana(const FGameplayAttributeData& OldValue)
 {
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UPlayerCoreAttributes, Stamina, OldValue);
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UPlayerCoreAttributes, Mana, OldValue);
 }
 
-void UPlayerCoreAttributes::OnRep_Mana(const FGameplayAttributeData& OldValue)
+void UPlayerCoreAttributes::OnRep_Stamina(const FGameplayAttributeData& OldValue)
 {
-	GAMEPLAYATTRIBUTE_REPNOTIFY(UPlayerCoreAttributes, Mana, OldValue);
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UPlayerCoreAttributes, Stamina, OldValue);
 }
 
 void UPlayerCoreAttributes::OnRep_Energy(const FGameplayAttributeData& OldValue)
@@ -59,8 +62,89 @@ void UPlayerCoreAttributes::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 //GEN-BEGIN: Replication Setup
 	DOREPLIFETIME_CONDITION_NOTIFY(UPlayerCoreAttributes, Health, COND_None, REPNOTIFY_Always);
 	DOREPLIFETIME_CONDITION_NOTIFY(UPlayerCoreAttributes, MaxHealth, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPlayerCoreAttributes, Stamina, COND_None, REPNOTIFY_Always);
 	DOREPLIFETIME_CONDITION_NOTIFY(UPlayerCoreAttributes, Mana, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_CONDITION_NOTIFY(UPlayerCoreAttributes, Stamina, COND_None, REPNOTIFY_Always);
 	DOREPLIFETIME_CONDITION_NOTIFY(UPlayerCoreAttributes, Energy, COND_None, REPNOTIFY_Always);
 	//GEN-END: Replication Setup
 }
+
+//GEN-BEGIN: Init GameplayEffect
+UGE_InitPlayerCoreAttributes::UGE_InitPlayerCoreAttributes()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FGameplayModifierInfo& HealthModifier = Modifiers.AddDefaulted_GetRef();
+	HealthModifier.Attribute = UPlayerCoreAttributes::GetHealthAttribute();
+	HealthModifier.ModifierOp = EGameplayModOp::Override;
+	HealthModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(100.00f));
+
+	FGameplayModifierInfo& MaxHealthModifier = Modifiers.AddDefaulted_GetRef();
+	MaxHealthModifier.Attribute = UPlayerCoreAttributes::GetMaxHealthAttribute();
+	MaxHealthModifier.ModifierOp = EGameplayModOp::Override;
+	MaxHealthModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(100.00f));
+
+	FGameplayModifierInfo& ManaModifier = Modifiers.AddDefaulted_GetRef();
+	ManaModifier.Attribute = UPlayerCoreAttributes::GetManaAttribute();
+	ManaModifier.ModifierOp = EGameplayModOp::Override;
+	ManaModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(50.00f));
+
+	FGameplayModifierInfo& StaminaModifier = Modifiers.AddDefaulted_GetRef();
+	StaminaModifier.Attribute = UPlayerCoreAttributes::GetStaminaAttribute();
+	StaminaModifier.ModifierOp = EGameplayModOp::Override;
+	StaminaModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(100.00f));
+
+	FGameplayModifierInfo& EnergyModifier = Modifiers.AddDefaulted_GetRef();
+	EnergyModifier.Attribute = UPlayerCoreAttributes::GetEnergyAttribute();
+	EnergyModifier.ModifierOp = EGameplayModOp::Override;
+	EnergyModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(50.00f));
+}
+//GEN-END: Init GameplayEffect
+
+//GEN-BEGIN: Init Attribute Registration
+namespace PlayerCoreAttributesInit
+{
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Health, "GasX.SetByCaller.PlayerCoreAttributes.Health");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_MaxHealth, "GasX.SetByCaller.PlayerCoreAttributes.MaxHealth");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Mana, "GasX.SetByCaller.PlayerCoreAttributes.Mana");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Stamina, "GasX.SetByCaller.PlayerCoreAttributes.Stamina");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Energy, "GasX.SetByCaller.PlayerCoreAttributes.Energy");
+
+	static void Describe(TArray<FGasXInitAttribute>& OutAttributes)
+	{
+		OutAttributes.Add({UPlayerCoreAttributes::GetHealthAttribute(), TAG_Health, 100.00f});
+		OutAttributes.Add({UPlayerCoreAttributes::GetMaxHealthAttribute(), TAG_MaxHealth, 100.00f});
+		OutAttributes.Add({UPlayerCoreAttributes::GetManaAttribute(), TAG_Mana, 50.00f});
+		OutAttributes.Add({UPlayerCoreAttributes::GetStaminaAttribute(), TAG_Stamina, 100.00f});
+		OutAttributes.Add({UPlayerCoreAttributes::GetEnergyAttribute(), TAG_Energy, 50.00f});
+	}
+
+	static FGasXInitAttributeRegistration Registration(&UPlayerCoreAttributes::StaticClass, &Describe);
+}
+//GEN-END: Init Attribute Registration
+
+//GEN-BEGIN: Attribute Flags
+TConstArrayView<FName> UPlayerCoreAttributes::GetFlagNames() const
+{
+	static const FName FlagNames[] = {
+		TEXT("Stunned"),
+		TEXT("InCombat"),
+		TEXT("Invulnerable"),
+	};
+	return FlagNames;
+}
+//GEN-END: Attribute Flags
+
+//GEN-BEGIN: Reset To Defaults
+void UPlayerCoreAttributes::ResetToDefaults()
+{
+	ResetAttribute(this, GetHealthAttribute(), 100.00f);
+	ResetAttribute(this, GetMaxHealthAttribute(), 100.00f);
+	ResetAttribute(this, GetManaAttribute(), 50.00f);
+	ResetAttribute(this, GetStaminaAttribute(), 100.00f);
+	ResetAttribute(this, GetEnergyAttribute(), 50.00f);
+	ResetFlagBits();
+}
+//GEN-END: Reset To Defaults
+
+//GEN-BEGIN: Journal Hooks
+//GEN-END: Journal Hooks
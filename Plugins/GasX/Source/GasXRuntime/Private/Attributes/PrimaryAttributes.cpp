@@ -3,6 +3,8 @@
 
 #include "Attributes/PrimaryAttributes.h"
 #include "Net/UnrealNetwork.h"
+#include "GasXInitAttributeRegistry.h"
+#include "NativeGameplayTags.h"
 
 UPrimaryAttributes::UPrimaryAttributes()
 {
@@ -44,3 +46,58 @@ void UPrimaryAttributes::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 	DOREPLIFETIME_CONDITION_NOTIFY(UPrimaryAttributes, Mana, COND_None, REPNOTIFY_Always);
 	//GEN-END: Replication Setup
 }
+
+//GEN-BEGIN: Init GameplayEffect
+UGE_InitPrimaryAttributes::UGE_InitPrimaryAttributes()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FGameplayModifierInfo& HealthModifier = Modifiers.AddDefaulted_GetRef();
+	HealthModifier.Attribute = UPrimaryAttributes::GetHealthAttribute();
+	HealthModifier.ModifierOp = EGameplayModOp::Override;
+	HealthModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(100.00f));
+
+	FGameplayModifierInfo& MaxHealthModifier = Modifiers.AddDefaulted_GetRef();
+	MaxHealthModifier.Attribute = UPrimaryAttributes::GetMaxHealthAttribute();
+	MaxHealthModifier.ModifierOp = EGameplayModOp::Override;
+	MaxHealthModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(100.00f));
+
+	FGameplayModifierInfo& ManaModifier = Modifiers.AddDefaulted_GetRef();
+	ManaModifier.Attribute = UPrimaryAttributes::GetManaAttribute();
+	ManaModifier.ModifierOp = EGameplayModOp::Override;
+	ManaModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(50.00f));
+}
+//GEN-END: Init GameplayEffect
+
+//GEN-BEGIN: Init Attribute Registration
+namespace PrimaryAttributesInit
+{
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Health, "GasX.SetByCaller.PrimaryAttributes.Health");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_MaxHealth, "GasX.SetByCaller.PrimaryAttributes.MaxHealth");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Mana, "GasX.SetByCaller.PrimaryAttributes.Mana");
+
+	static void Describe(TArray<FGasXInitAttribute>& OutAttributes)
+	{
+		OutAttributes.Add({UPrimaryAttributes::GetHealthAttribute(), TAG_Health, 100.00f});
+		OutAttributes.Add({UPrimaryAttributes::GetMaxHealthAttribute(), TAG_MaxHealth, 100.00f});
+		OutAttributes.Add({UPrimaryAttributes::GetManaAttribute(), TAG_Mana, 50.00f});
+	}
+
+	static FGasXInitAttributeRegistration Registration(&UPrimaryAttributes::StaticClass, &Describe);
+}
+//GEN-END: Init Attribute Registration
+
+//GEN-BEGIN: Attribute Flags
+//GEN-END: Attribute Flags
+
+//GEN-BEGIN: Reset To Defaults
+void UPrimaryAttributes::ResetToDefaults()
+{
+	ResetAttribute(this, GetHealthAttribute(), 100.00f);
+	ResetAttribute(this, GetMaxHealthAttribute(), 100.00f);
+	ResetAttribute(this, GetManaAttribute(), 50.00f);
+}
+//GEN-END: Reset To Defaults
+
+//GEN-BEGIN: Journal Hooks
+//GEN-END: Journal Hooks
@@ -0,0 +1,46 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXAsyncWaitAttributesReady.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXAttributesReady, Log, All);
+
+UGasXAsyncWaitAttributesReady* UGasXAsyncWaitAttributesReady::WaitForAttributesReady(AActor* Actor)
+{
+	UGasXAsyncWaitAttributesReady* Action = NewObject<UGasXAsyncWaitAttributesReady>();
+	Action->WeakActor = Actor;
+	Action->RegisterWithGameInstance(Actor);
+	return Action;
+}
+
+void UGasXAsyncWaitAttributesReady::Activate()
+{
+	AActor* Actor = WeakActor.Get();
+	UGasXAttributeBootstrapComponent* Component = Actor ? Actor->FindComponentByClass<UGasXAttributeBootstrapComponent>() : nullptr;
+	if (!Component)
+	{
+		UE_LOG(LogGasXAttributesReady, Warning, TEXT("WaitForAttributesReady: %s has no GasXAttributeBootstrapComponent"), Actor ? *Actor->GetName() : TEXT("null actor"));
+		SetReadyToDestroy();
+		return;
+	}
+
+	if (Component->AreAttributesReady())
+	{
+		HandleAttributesReady();
+		return;
+	}
+
+	WeakComponent = Component;
+	Component->OnAttributesReady.AddUniqueDynamic(this, &UGasXAsyncWaitAttributesReady::HandleAttributesReady);
+}
+
+void UGasXAsyncWaitAttributesReady::HandleAttributesReady()
+{
+	if (UGasXAttributeBootstrapComponent* Component = WeakComponent.Get())
+	{
+		Component->OnAttributesReady.RemoveDynamic(this, &UGasXAsyncWaitAttributesReady::HandleAttributesReady);
+	}
+
+	OnReady.Broadcast();
+	SetReadyToDestroy();
+}
@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXAttributeArray.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXAttributeArray, Log, All);
+
+void FGasXAttributeArrayElement::PostReplicatedAdd(const FGasXAttributeArray& InArraySerializer)
+{
+	// WHY: Unwritten elements read as the default, so the first replicated write changes from the default
+	const float OldValue = InArraySerializer.DefaultValue;
+	NotifiedValue = CurrentValue;
+	InArraySerializer.OnElementChanged.Broadcast(InArraySerializer.ArrayName, Index, OldValue, CurrentValue);
+}
+
+void FGasXAttributeArrayElement::PostReplicatedChange(const FGasXAttributeArray& InArraySerializer)
+{
+	const float OldValue = NotifiedValue;
+	NotifiedValue = CurrentValue;
+	InArraySerializer.OnElementChanged.Broadcast(InArraySerializer.ArrayName, Index, OldValue, CurrentValue);
+}
+
+void FGasXAttributeArray::Init(FName InArrayName, int32 InNumElements, float InDefaultValue)
+{
+	ensureMsgf(InNumElements >= 0 && InNumElements <= MaxElements, TEXT("Attribute array %s has %d elements (max %d)"), *InArrayName.ToString(), InNumElements, MaxElements);
+
+	ArrayName = InArrayName;
+	NumElements = FMath::Clamp(InNumElements, 0, MaxElements);
+	DefaultValue = InDefaultValue;
+}
+
+float FGasXAttributeArray::GetBaseValue(int32 Index) const
+{
+	const FGasXAttributeArrayElement* Element = FindElement(Index);
+	return Element ? Element->BaseValue : DefaultValue;
+}
+
+float FGasXAttributeArray::GetCurrentValue(int32 Index) const
+{
+	const FGasXAttributeArrayElement* Element = FindElement(Index);
+	return Element ? Element->CurrentValue : DefaultValue;
+}
+
+void FGasXAttributeArray::SetBaseValue(int32 Index, float NewValue)
+{
+	FGasXAttributeArrayElement* Element = FindOrAddElement(Index);
+	if (!Element || (Element->BaseValue == NewValue && Element->CurrentValue == NewValue))
+	{
+		return;
+	}
+
+	const float OldValue = Element->CurrentValue;
+	Element->BaseValue = NewValue;
+	Element->CurrentValue = NewValue;
+	Element->NotifiedValue = NewValue;
+	MarkItemDirty(*Element);
+
+	if (OldValue != NewValue)
+	{
+		OnElementChanged.Broadcast(ArrayName, Index, OldValue, NewValue);
+	}
+}
+
+void FGasXAttributeArray::SetCurrentValue(int32 Index, float NewValue)
+{
+	FGasXAttributeArrayElement* Element = FindOrAddElement(Index);
+	if (!Element || Element->CurrentValue == NewValue)
+	{
+		return;
+	}
+
+	const float OldValue = Element->CurrentValue;
+	Element->CurrentValue = NewValue;
+	Element->NotifiedValue = NewValue;
+	MarkItemDirty(*Element);
+
+	OnElementChanged.Broadcast(ArrayName, Index, OldValue, NewValue);
+}
+
+void FGasXAttributeArray::ResetToDefaults()
+{
+	// WHY: Keep the elements rather than removing them, so clients receive the default through the same change path
+	for (FGasXAttributeArrayElement& Element : Elements)
+	{
+		if (Element.BaseValue == DefaultValue && Element.CurrentValue == DefaultValue)
+		{
+			continue;
+		}
+
+		const float OldValue = Element.CurrentValue;
+		Element.BaseValue = DefaultValue;
+		Element.CurrentValue = DefaultValue;
+		Element.NotifiedValue = DefaultValue;
+		MarkItemDirty(Element);
+
+		if (OldValue != DefaultValue)
+		{
+			OnElementChanged.Broadcast(ArrayName, Element.Index, OldValue, DefaultValue);
+		}
+	}
+}
+
+const FGasXAttributeArrayElement* FGasXAttributeArray::FindElement(int32 Index) const
+{
+	// NOTE: Arrays hold dozens of elements at most; a scan is cheaper than an index map that clients would have to
+	// rebuild on every replicated add
+	for (const FGasXAttributeArrayElement& Element : Elements)
+	{
+		if (Element.Index == Index)
+		{
+			return &Element;
+		}
+	}
+	return nullptr;
+}
+
+FGasXAttributeArrayElement* FGasXAttributeArray::FindOrAddElement(int32 Index)
+{
+	if (Index < 0 || Index >= NumElements)
+	{
+		UE_LOG(LogGasXAttributeArray, Error, TEXT("Index %d out of range for attribute array %s (%d elements)"), Index, *ArrayName.ToString(), NumElements);
+		return nullptr;
+	}
+
+	if (const FGasXAttributeArrayElement* Existing = FindElement(Index))
+	{
+		return const_cast<FGasXAttributeArrayElement*>(Existing);
+	}
+
+	FGasXAttributeArrayElement& Element = Elements.AddDefaulted_GetRef();
+	Element.Index = static_cast<uint16>(Index);
+	Element.BaseValue = DefaultValue;
+	Element.CurrentValue = DefaultValue;
+	Element.NotifiedValue = DefaultValue;
+	return &Element;
+}
@@ -4,22 +4,72 @@
 #include "AbilitySystemComponent.h"
 #include "AttributeSet.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "AbilitySystemInterface.h"
 #include "GameplayEffect.h"
 #include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Attributes/GasXDebugAttributes.h"
+#include "GasXUniversalInitEffect.h"
+#include "GasXLevelCurveSamples.h"
+#include "Engine/CurveTable.h"
+#include "GasXBakedAttributeDefaults.h"
+#include "GasXResettableAttributeSet.h"
+#include "GasXLiveTuningSubsystem.h"
+#include "GasXAttributeTelemetrySubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogGASInit, Log, All);
 
 UGasXAttributeBootstrapComponent::UGasXAttributeBootstrapComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
+    SetIsReplicatedByDefault(true);
+}
+
+void UGasXAttributeBootstrapComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(UGasXAttributeBootstrapComponent, ReadyAttributeSets);
+}
+
+void UGasXAttributeBootstrapComponent::PostLoad()
+{
+    Super::PostLoad();
+
+    // WHY: Sample level curves when the referencing component loads, so the first spawn only indexes arrays
+    if (AttributeCurveTable)
+    {
+        FGasXLevelCurveSamples::Get(AttributeCurveTable);
+    }
 }
 
 void UGasXAttributeBootstrapComponent::BeginPlay()
 {
     Super::BeginPlay();
     ExecuteBootstrap();
+
+    // WHY: With no eager sets there is nothing to replicate, so clients are ready as soon as they start
+    AActor* Owner = GetOwner();
+    if (Owner && !Owner->HasAuthority() && AttributeSetTypes.Num() == 0)
+    {
+        MarkAttributesReady();
+    }
+}
+
+void UGasXAttributeBootstrapComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ReleaseAbilitySystemComponent();
+    if (APawn* Pawn = Cast<APawn>(GetOwner()))
+    {
+        Pawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &UGasXAttributeBootstrapComponent::HandleControllerChanged);
+    }
+    PendingLazySetClasses.Reset();
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UGasXAttributeBootstrapComponent::ExecuteBootstrap()
@@ -41,9 +91,22 @@ void UGasXAttributeBootstrapComponent::ExecuteBootstrap()
     
     UE_LOG(LogGASInit, Log, TEXT("[SERVER] ExecuteBootstrap for %s"), *Owner->GetName());
 
-    UAbilitySystemComponent* ASC = Owner->FindComponentByClass<UAbilitySystemComponent>();
+    // WHY: An ASC hosted on the PlayerState is only reachable once a controller possesses the pawn,
+    // and moves to another PlayerState's ASC when a different player re-possesses it
+    if (APawn* Pawn = Cast<APawn>(Owner))
+    {
+        Pawn->ReceiveControllerChangedDelegate.AddUniqueDynamic(this, &UGasXAttributeBootstrapComponent::HandleControllerChanged);
+    }
+
+    UAbilitySystemComponent* ASC = ResolveAbilitySystemComponent();
     if (!ASC)
     {
+        if (Cast<APawn>(Owner))
+        {
+            UE_LOG(LogGASInit, Log, TEXT("[SERVER] No AbilitySystemComponent reachable from %s yet - deferring bootstrap until possession"), *Owner->GetName());
+            return;
+        }
+
         UE_LOG(LogGASInit, Warning, TEXT("No AbilitySystemComponent found on %s. Skipping attribute initialization."), *Owner->GetName());
         return;
     }
@@ -66,9 +129,20 @@ void UGasXAttributeBootstrapComponent::ExecuteBootstrap()
 
         // WHY: Check for existing AttributeSet instance to ensure idempotency
         // Prevents duplicate AttributeSets on PIE restart, Game Feature re-activation, or respawn
-        if (HasAttributeSet(ASC, SetClass))
+        if (UAttributeSet* ExistingSet = FindAttributeSet(ASC, SetClass))
         {
-            UE_LOG(LogGASInit, Log, TEXT("[SERVER] AttributeSet %s already present on %s - skipping duplicate"), *SetClass->GetName(), *Owner->GetName());
+            // WHY: Restoring compiled defaults in place is far cheaper than destroying and re-creating the subobject,
+            // and stops the set carrying stale values into the next life
+            IGasXResettableAttributeSet* ResettableSet = Cast<IGasXResettableAttributeSet>(ExistingSet);
+            if (bResetExistingSets && ResettableSet)
+            {
+                ResettableSet->ResetToDefaults();
+                UE_LOG(LogGASInit, Log, TEXT("[SERVER] AttributeSet %s already present on %s - reset to defaults"), *SetClass->GetName(), *Owner->GetName());
+            }
+            else
+            {
+                UE_LOG(LogGASInit, Log, TEXT("[SERVER] AttributeSet %s already present on %s - skipping duplicate"), *SetClass->GetName(), *Owner->GetName());
+            }
             continue;
         }
 
@@ -92,18 +166,67 @@ void UGasXAttributeBootstrapComponent::ExecuteBootstrap()
         }
     }
 
+    // WHY: Lazy sets that survived a respawn are reset like any other; the rest wait for first use
+    PendingLazySetClasses.Reset();
+    for (const TSoftClassPtr<UAttributeSet>& SetClassPtr : LazyAttributeSetTypes)
+    {
+        UClass* SetClass = SetClassPtr.Get();
+        if (!SetClass)
+        {
+            UE_LOG(LogGASInit, Warning, TEXT("Unable to load lazy AttributeSet class for %s"), *Owner->GetName());
+            continue;
+        }
+
+        if (UAttributeSet* ExistingSet = FindAttributeSet(ASC, SetClass))
+        {
+            if (IGasXResettableAttributeSet* ResettableSet = Cast<IGasXResettableAttributeSet>(ExistingSet); bResetExistingSets && ResettableSet)
+            {
+                ResettableSet->ResetToDefaults();
+            }
+            continue;
+        }
+        PendingLazySetClasses.AddUnique(SetClass);
+    }
+
+    ASC->GameplayEffectApplicationQueries.RemoveAll([this](const FGameplayEffectApplicationQuery& Query) { return Query.IsBoundToObject(this); });
+    if (PendingLazySetClasses.Num() > 0)
+    {
+        ASC->GameplayEffectApplicationQueries.Add(FGameplayEffectApplicationQuery::CreateUObject(this, &UGasXAttributeBootstrapComponent::OnEffectApplicationQuery));
+    }
+
     // Initialize attributes according to selected path
     InitializeAttributes(ASC);
+
+    // WHY: Telemetry only reads registered sets, so it never has to walk actors to find them
+    if (UGasXAttributeTelemetrySubsystem* Telemetry = UWorld::GetSubsystem<UGasXAttributeTelemetrySubsystem>(GetWorld()))
+    {
+        for (const UAttributeSet* Set : ASC->GetSpawnedAttributes())
+        {
+            Telemetry->RegisterSet(Set);
+        }
+    }
+
+    RegisterReplicationLOD(ASC);
+
+    ReadyAttributeSets.Reset();
+    for (const TSoftClassPtr<UAttributeSet>& SetClassPtr : AttributeSetTypes)
+    {
+        if (UAttributeSet* Set = FindAttributeSet(ASC, SetClassPtr.Get()))
+        {
+            ReadyAttributeSets.Add(Set);
+        }
+    }
+    MarkAttributesReady();
 }
 
-bool UGasXAttributeBootstrapComponent::HasAttributeSet(UAbilitySystemComponent* ASC, TSubclassOf<UAttributeSet> AttributeSetClass) const
+UAttributeSet* UGasXAttributeBootstrapComponent::FindAttributeSet(UAbilitySystemComponent* ASC, TSubclassOf<UAttributeSet> AttributeSetClass) const
 {
     // WHY: Must prevent duplicate AttributeSets by checking ASC's spawned attributes array
     // Iterates GetSpawnedAttributes() and compares by class to ensure idempotency
     // Required by Requirements.md R14 and Priority Adjustments 1.1
     if (!ASC || !AttributeSetClass)
     {
-        return false;
+        return nullptr;
     }
 
     // WHAT: Iterate all spawned attribute sets and check for exact class match
@@ -112,11 +235,11 @@ bool UGasXAttributeBootstrapComponent::HasAttributeSet(UAbilitySystemComponent*
     {
         if (ExistingSet && ExistingSet->GetClass() == AttributeSetClass)
         {
-            return true;
+            return ExistingSet;
         }
     }
 
-    return false;
+    return nullptr;
 }
 
 void UGasXAttributeBootstrapComponent::InitializeAttributes(UAbilitySystemComponent* ASC)
@@ -146,6 +269,20 @@ void UGasXAttributeBootstrapComponent::InitializeAttributes(UAbilitySystemCompon
         }
     }
 
+    // If the universal init effect is requested, initialize all generated sets with a single spec
+    if (bUseUniversalInitEffect)
+    {
+        TArray<const UClass*> SetClasses;
+        for (const TSoftClassPtr<UAttributeSet>& SetClassPtr : AttributeSetTypes)
+        {
+            if (const UClass* SetClass = SetClassPtr.Get())
+            {
+                SetClasses.Add(SetClass);
+            }
+        }
+        ApplyUniversalInitEffect(ASC, SetClasses);
+    }
+
     // If InitGameplayEffect is requested and available, use it
     if (bUseInitGameplayEffect && InitGameplayEffect)
     {
@@ -160,3 +297,223 @@ void UGasXAttributeBootstrapComponent::InitializeAttributes(UAbilitySystemCompon
 
     // Fallback: nothing to do - generated AttributeSet classes may initialize their own defaults in constructors
 }
+
+void UGasXAttributeBootstrapComponent::ApplyUniversalInitEffect(UAbilitySystemComponent* ASC, TConstArrayView<const UClass*> SetClasses)
+{
+    AActor* Owner = GetOwner();
+
+    UGasXUniversalInitEffect* Effect = UGasXUniversalInitEffect::GetForSets(SetClasses);
+    if (!Effect)
+    {
+        UE_LOG(LogGASInit, Verbose, TEXT("No generated AttributeSets with init attributes on %s - skipping universal init effect"), *Owner->GetName());
+        return;
+    }
+
+    // WHY: One spec for every set means one aggregator update and one replication event per spawn
+    FGameplayEffectSpec Spec(Effect, ASC->MakeEffectContext(), 1.0f);
+    const TSharedPtr<const FGasXLevelCurveSamples> LevelCurves = FGasXLevelCurveSamples::Get(AttributeCurveTable);
+
+    FGasXInitValueSources Sources;
+    Sources.LevelCurves = LevelCurves.Get();
+    Sources.Level = AttributeLevel;
+    Sources.MetadataTable = bUseInitStatsDataTable ? AttributeMetadataTable : nullptr;
+    Sources.BakedDefaults = BakedAttributeDefaults;
+    Effect->FillSpec(Spec, Sources);
+    ASC->ApplyGameplayEffectSpecToSelf(Spec);
+
+    UE_LOG(LogGASInit, Log, TEXT("[SERVER] Applied universal init effect (%d attributes) to %s"), Effect->GetInitAttributes().Num(), *Owner->GetName());
+
+    // WHY: Later metadata table edits reach this actor without a respawn
+    if (bApplyLiveTuning && Sources.MetadataTable)
+    {
+        if (UGasXLiveTuningSubsystem* LiveTuning = UWorld::GetSubsystem<UGasXLiveTuningSubsystem>(GetWorld()))
+        {
+            LiveTuning->RegisterTarget(ASC, AttributeMetadataTable, AttributeCurveTable);
+        }
+    }
+}
+
+UAttributeSet* UGasXAttributeBootstrapComponent::GetOrCreateAttributeSet(TSubclassOf<UAttributeSet> SetClass)
+{
+    AActor* Owner = GetOwner();
+    UAbilitySystemComponent* ASC = Owner ? ResolveAbilitySystemComponent() : nullptr;
+    if (UAttributeSet* ExistingSet = FindAttributeSet(ASC, SetClass))
+    {
+        return ExistingSet;
+    }
+
+    // WHY: Clients only ever see the server's instance through replication
+    if (!ASC || !Owner->HasAuthority() || !PendingLazySetClasses.Contains(SetClass.Get()))
+    {
+        return nullptr;
+    }
+    return CreateLazySet(ASC, SetClass);
+}
+
+UAttributeSet* UGasXAttributeBootstrapComponent::CreateLazySet(UAbilitySystemComponent* ASC, UClass* SetClass)
+{
+    // NOTE: The application query stays bound even once nothing is pending; it may be mid-iteration right now
+    PendingLazySetClasses.Remove(SetClass);
+
+    UAttributeSet* NewSet = NewObject<UAttributeSet>(ASC, SetClass);
+    ASC->AddAttributeSetSubobject(NewSet);
+    UE_LOG(LogGASInit, Log, TEXT("[SERVER] Lazily added AttributeSet %s to %s"), *SetClass->GetName(), *GetOwner()->GetName());
+
+    // NOTE: Only the universal init effect can target a single set; other init paths rely on the constructor defaults
+    if (bUseUniversalInitEffect)
+    {
+        const UClass* SetClasses[] = {SetClass};
+        ApplyUniversalInitEffect(ASC, SetClasses);
+    }
+
+    if (UGasXAttributeTelemetrySubsystem* Telemetry = UWorld::GetSubsystem<UGasXAttributeTelemetrySubsystem>(GetWorld()))
+    {
+        Telemetry->RegisterSet(NewSet);
+    }
+
+    RegisterReplicationLOD(ASC);
+    return NewSet;
+}
+
+bool UGasXAttributeBootstrapComponent::OnEffectApplicationQuery(const FActiveGameplayEffectsContainer& ActiveEffects, const FGameplayEffectSpec& Spec)
+{
+    UAbilitySystemComponent* ASC = CachedASC.Get();
+    if (PendingLazySetClasses.Num() == 0 || !ASC || !Spec.Def || !ASC->IsOwnerActorAuthoritative())
+    {
+        return true;
+    }
+
+    // WHY: Runs before the effect lands, so its modifiers find the set they target.
+    // NOTE: Execution calculations declare no target attributes up front; call GetOrCreateAttributeSet() for those.
+    for (const FGameplayModifierInfo& Modifier : Spec.Def->Modifiers)
+    {
+        UClass* SetClass = Modifier.Attribute.GetAttributeSetClass();
+        if (SetClass && PendingLazySetClasses.Contains(SetClass))
+        {
+            CreateLazySet(ASC, SetClass);
+        }
+    }
+
+    // Never blocks the application
+    return true;
+}
+
+void UGasXAttributeBootstrapComponent::RegisterReplicationLOD(UAbilitySystemComponent* ASC)
+{
+    if (ReplicationLODSettings.Num() == 0)
+    {
+        return;
+    }
+
+    if (UGasXReplicationLODSubsystem* ReplicationLOD = UWorld::GetSubsystem<UGasXReplicationLODSubsystem>(GetWorld()))
+    {
+        ReplicationLOD->RegisterActor(GetOwner(), ASC, ReplicationLODSettings);
+    }
+}
+
+UAbilitySystemComponent* UGasXAttributeBootstrapComponent::ResolveAbilitySystemComponent()
+{
+    if (UAbilitySystemComponent* ASC = CachedASC.Get())
+    {
+        return ASC;
+    }
+
+    UAbilitySystemComponent* ASC = FindAbilitySystemComponent(GetOwner());
+    CachedASC = ASC;
+    return ASC;
+}
+
+UAbilitySystemComponent* UGasXAttributeBootstrapComponent::FindAbilitySystemComponent(const AActor* Owner)
+{
+    if (!Owner)
+    {
+        return nullptr;
+    }
+
+    // WHY: The interface is the GAS-standard way to publish an ASC and is a virtual call, not a component scan
+    if (const IAbilitySystemInterface* OwnerInterface = Cast<IAbilitySystemInterface>(Owner))
+    {
+        if (UAbilitySystemComponent* ASC = OwnerInterface->GetAbilitySystemComponent())
+        {
+            return ASC;
+        }
+    }
+
+    const APawn* Pawn = Cast<APawn>(Owner);
+    if (const IAbilitySystemInterface* PlayerStateInterface = Pawn ? Cast<IAbilitySystemInterface>(Pawn->GetPlayerState()) : nullptr)
+    {
+        if (UAbilitySystemComponent* ASC = PlayerStateInterface->GetAbilitySystemComponent())
+        {
+            return ASC;
+        }
+    }
+
+    return Owner->FindComponentByClass<UAbilitySystemComponent>();
+}
+
+void UGasXAttributeBootstrapComponent::ReleaseAbilitySystemComponent()
+{
+    if (UGasXReplicationLODSubsystem* ReplicationLOD = UWorld::GetSubsystem<UGasXReplicationLODSubsystem>(GetWorld()))
+    {
+        ReplicationLOD->UnregisterActor(GetOwner());
+    }
+
+    if (UAbilitySystemComponent* ASC = CachedASC.Get())
+    {
+        ASC->GameplayEffectApplicationQueries.RemoveAll([this](const FGameplayEffectApplicationQuery& Query) { return Query.IsBoundToObject(this); });
+    }
+    CachedASC.Reset();
+}
+
+void UGasXAttributeBootstrapComponent::HandleControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+    // NOTE: Unpossessing keeps the cache; the next possession decides whether the ASC moved
+    if (!NewController || !Pawn->HasAuthority())
+    {
+        return;
+    }
+
+    UAbilitySystemComponent* PreviousASC = CachedASC.Get();
+    CachedASC.Reset();
+    UAbilitySystemComponent* ASC = ResolveAbilitySystemComponent();
+    if (ASC == PreviousASC)
+    {
+        // NOTE: Same ASC (e.g. the same player re-possessing); possession changes must not reset attributes mid-life
+        return;
+    }
+
+    // WHY: A different PlayerState hosts a different ASC; drop the old one's query and LOD registration before moving on
+    CachedASC = PreviousASC;
+    ReleaseAbilitySystemComponent();
+    if (ASC)
+    {
+        ExecuteBootstrap();
+    }
+}
+
+void UGasXAttributeBootstrapComponent::OnRep_ReadyAttributeSets()
+{
+    // NOTE: Entries stay null until the referenced set has replicated; this runs again as each one maps
+    if (bAttributesReady || ReadyAttributeSets.Num() == 0 || ReadyAttributeSets.Contains(nullptr))
+    {
+        return;
+    }
+
+    // WHY: The sets' own OnReps may run after this one in the same bunch; wait for the next tick so they have all run
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this]() { MarkAttributesReady(); }));
+    }
+}
+
+void UGasXAttributeBootstrapComponent::MarkAttributesReady()
+{
+    // NOTE: One-shot; a respawn re-bootstrap keeps the sets and must not re-fire listeners
+    if (bAttributesReady)
+    {
+        return;
+    }
+
+    bAttributesReady = true;
+    OnAttributesReady.Broadcast();
+}
@@ -0,0 +1,153 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXAttributeCensus.h"
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXCensus, Log, All);
+
+namespace GasXAttributeCensus
+{
+	static int64 GetInstanceBytes(UAttributeSet* Set)
+	{
+		// WHY: FArchiveCountMem already counts the class size (UObject::Serialize adds GetStructureSize()) plus heap owned
+		// by arrays such as FGasXAttributeArray; only the object array slot lives outside what it sees
+		FArchiveCountMem CountMem(Set);
+		return int64(CountMem.GetMax()) + int64(sizeof(FUObjectItem));
+	}
+
+	static bool IsReplicatedSubObject(const UAbilitySystemComponent& ASC, const UAttributeSet& Set)
+	{
+		const AActor* Owner = ASC.GetOwner();
+		if (!ASC.GetIsReplicated() || !Owner || !Owner->GetIsReplicated())
+		{
+			return false;
+		}
+
+		// NOTE: Without the registered list, a replicated ASC replicates every spawned set through ReplicateSubobjects
+		return !Owner->IsUsingRegisteredSubObjectList() || ASC.IsReplicatedSubObjectRegistered(&Set);
+	}
+
+	static void CensusCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		TArray<FGasXAttributeCensusEntry> Entries;
+		const int32 NumASCs = FGasXAttributeCensus::Collect(World, Entries);
+
+		int32 TotalInstances = 0;
+		int32 TotalReplicated = 0;
+		int64 TotalBytes = 0;
+		for (const FGasXAttributeCensusEntry& Entry : Entries)
+		{
+			UE_LOG(LogGasXCensus, Display, TEXT("%-40s instances=%6d replicated=%6d bytes/instance=%6lld total=%10lld at-default=%5.1f%%"),
+				*Entry.SetClassName.ToString(), Entry.NumInstances, Entry.NumReplicated, Entry.GetBytesPerInstance(), Entry.TotalBytes,
+				Entry.GetDefaultFraction() * 100.0);
+
+			TotalInstances += Entry.NumInstances;
+			TotalReplicated += Entry.NumReplicated;
+			TotalBytes += Entry.TotalBytes;
+		}
+		UE_LOG(LogGasXCensus, Display, TEXT("%d ASC(s), %d set(s), %d replicated, %.1f KB total"), NumASCs, TotalInstances, TotalReplicated, TotalBytes / 1024.0);
+
+		if (Args.Num() > 0)
+		{
+			if (FFileHelper::SaveStringToFile(FGasXAttributeCensus::ToCsv(Entries), *Args[0]))
+			{
+				UE_LOG(LogGasXCensus, Display, TEXT("Wrote attribute census to %s"), *Args[0]);
+			}
+			else
+			{
+				UE_LOG(LogGasXCensus, Error, TEXT("Failed to write attribute census to %s"), *Args[0]);
+			}
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs CensusCmd(
+		TEXT("GasX.Census"),
+		TEXT("Log per-class AttributeSet counts, memory, replication and default-value fraction for this world. Usage: GasX.Census [csv file]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&CensusCommand));
+}
+
+int32 FGasXAttributeCensus::Collect(const UWorld* World, TArray<FGasXAttributeCensusEntry>& OutEntries)
+{
+	OutEntries.Reset();
+	if (!World)
+	{
+		return 0;
+	}
+
+	TMap<const UClass*, FGasXAttributeCensusEntry> EntriesByClass;
+	TMap<const UClass*, TArray<const FProperty*>> AttributePropertiesByClass;
+	int32 NumASCs = 0;
+
+	for (TObjectIterator<UAbilitySystemComponent> It; It; ++It)
+	{
+		const UAbilitySystemComponent* ASC = *It;
+		if (ASC->IsTemplate() || ASC->GetWorld() != World)
+		{
+			continue;
+		}
+		++NumASCs;
+
+		for (UAttributeSet* Set : ASC->GetSpawnedAttributes())
+		{
+			if (!Set)
+			{
+				continue;
+			}
+
+			const UClass* SetClass = Set->GetClass();
+			FGasXAttributeCensusEntry& Entry = EntriesByClass.FindOrAdd(SetClass);
+			Entry.SetClassName = SetClass->GetFName();
+			++Entry.NumInstances;
+			Entry.NumReplicated += GasXAttributeCensus::IsReplicatedSubObject(*ASC, *Set) ? 1 : 0;
+			Entry.TotalBytes += GasXAttributeCensus::GetInstanceBytes(Set);
+
+			TArray<const FProperty*>* AttributeProperties = AttributePropertiesByClass.Find(SetClass);
+			if (!AttributeProperties)
+			{
+				AttributeProperties = &AttributePropertiesByClass.Add(SetClass);
+				for (TFieldIterator<FProperty> PropIt(SetClass); PropIt; ++PropIt)
+				{
+					if (FGameplayAttribute::IsGameplayAttributeDataProperty(*PropIt))
+					{
+						AttributeProperties->Add(*PropIt);
+					}
+				}
+			}
+
+			// WHY: Compare against the CDO rather than the schema, so hand-written sets are counted too
+			const UObject* ClassDefault = SetClass->GetDefaultObject();
+			for (const FProperty* Property : *AttributeProperties)
+			{
+				++Entry.NumAttributes;
+				if (Property->Identical_InContainer(Set, ClassDefault))
+				{
+					++Entry.NumAttributesAtDefault;
+				}
+			}
+		}
+	}
+
+	EntriesByClass.GenerateValueArray(OutEntries);
+	OutEntries.Sort([](const FGasXAttributeCensusEntry& A, const FGasXAttributeCensusEntry& B) { return A.TotalBytes > B.TotalBytes; });
+	return NumASCs;
+}
+
+FString FGasXAttributeCensus::ToCsv(TConstArrayView<FGasXAttributeCensusEntry> Entries)
+{
+	FString Csv = TEXT("SetClass,Instances,Replicated,BytesPerInstance,TotalBytes,Attributes,AttributesAtDefault,DefaultFraction\n");
+	for (const FGasXAttributeCensusEntry& Entry : Entries)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%lld,%lld,%lld,%lld,%.4f\n"),
+			*Entry.SetClassName.ToString(), Entry.NumInstances, Entry.NumReplicated, Entry.GetBytesPerInstance(), Entry.TotalBytes,
+			Entry.NumAttributes, Entry.NumAttributesAtDefault, Entry.GetDefaultFraction());
+	}
+	return Csv;
+}
@@ -0,0 +1,261 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXAttributeHistoryComponent.h"
+#include "AbilitySystemComponent.h"
+#include "GameFramework/Actor.h"
+#include "GasXAttributeBootstrapComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXHistory, Log, All);
+
+UGasXAttributeHistoryComponent::UGasXAttributeHistoryComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	// WHY: Record after effects and movement have settled, so a frame's record is what that frame ended with
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+void UGasXAttributeHistoryComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	const AActor* Owner = GetOwner();
+	if (bAutoRecord && Owner && Owner->HasAuthority())
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UGasXAttributeHistoryComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	RecordFrame(GFrameCounter);
+}
+
+bool UGasXAttributeHistoryComponent::BindSet()
+{
+	if (BoundSet.IsValid())
+	{
+		return true;
+	}
+
+	// WHY: Same lookup as the bootstrap, so PlayerState-hosted ASCs are found once the pawn is possessed
+	UAbilitySystemComponent* ASC = UGasXAttributeBootstrapComponent::FindAbilitySystemComponent(GetOwner());
+	if (!ASC || !AttributeSetClass)
+	{
+		return false;
+	}
+
+	// NOTE: The bootstrap may add the set after this component begins play; keep looking until it shows up
+	UAttributeSet* Set = nullptr;
+	for (UAttributeSet* SpawnedSet : ASC->GetSpawnedAttributes())
+	{
+		if (SpawnedSet && SpawnedSet->GetClass() == AttributeSetClass)
+		{
+			Set = SpawnedSet;
+			break;
+		}
+	}
+	if (!Set)
+	{
+		return false;
+	}
+
+	Attributes.Reset();
+	for (TFieldIterator<FProperty> It(AttributeSetClass); It; ++It)
+	{
+		if (!FGameplayAttribute::IsGameplayAttributeDataProperty(*It))
+		{
+			continue;
+		}
+
+		if (Attributes.Num() == MaxAttributes)
+		{
+			UE_LOG(LogGasXHistory, Warning, TEXT("%s has more than %d attributes; history ignores %s and later ones"), *AttributeSetClass->GetName(), MaxAttributes, *It->GetName());
+			break;
+		}
+		Attributes.Emplace(*It);
+	}
+
+	// WHY: All storage is sized here, once; recording only overwrites slots
+	const int32 NumSlots = FMath::Max(2, Capacity);
+	SlotFrames.SetNumZeroed(NumSlots);
+	SlotDirtyMasks.SetNumZeroed(NumSlots);
+	BaseValues.SetNumZeroed(NumSlots * Attributes.Num());
+	CurrentValues.SetNumZeroed(NumSlots * Attributes.Num());
+	Head = INDEX_NONE;
+	NumRecorded = 0;
+
+	BoundASC = ASC;
+	BoundSet = Set;
+	return true;
+}
+
+bool UGasXAttributeHistoryComponent::RecordFrame(uint64 Frame)
+{
+	if (!BindSet())
+	{
+		return false;
+	}
+
+	if (NumRecorded > 0 && Frame <= SlotFrames[Head])
+	{
+		UE_LOG(LogGasXHistory, Verbose, TEXT("Ignoring out-of-order record for frame %llu (newest is %llu)"), Frame, SlotFrames[Head]);
+		return false;
+	}
+
+	const int32 NumSlots = SlotFrames.Num();
+	const int32 NumAttributes = Attributes.Num();
+	const int32 PreviousSlot = Head;
+	Head = (Head + 1) % NumSlots;
+
+	const UAttributeSet* Set = BoundSet.Get();
+	float* Base = BaseValues.GetData() + Head * NumAttributes;
+	float* Current = CurrentValues.GetData() + Head * NumAttributes;
+	const float* PreviousBase = NumRecorded > 0 ? BaseValues.GetData() + PreviousSlot * NumAttributes : nullptr;
+	const float* PreviousCurrent = NumRecorded > 0 ? CurrentValues.GetData() + PreviousSlot * NumAttributes : nullptr;
+
+	uint64 DirtyMask = 0;
+	for (int32 Index = 0; Index < NumAttributes; ++Index)
+	{
+		const FGameplayAttributeData* Data = Attributes[Index].GetGameplayAttributeData(const_cast<UAttributeSet*>(Set));
+		Base[Index] = Data->GetBaseValue();
+		Current[Index] = Data->GetCurrentValue();
+
+		// NOTE: The first record has nothing to compare against, so every attribute counts as changed
+		if (!PreviousBase || Base[Index] != PreviousBase[Index] || Current[Index] != PreviousCurrent[Index])
+		{
+			DirtyMask |= 1ull << Index;
+		}
+	}
+
+	SlotFrames[Head] = Frame;
+	SlotDirtyMasks[Head] = DirtyMask;
+	NumRecorded = FMath::Min(NumRecorded + 1, NumSlots);
+	return true;
+}
+
+int32 UGasXAttributeHistoryComponent::LogicalToSlot(int32 LogicalIndex) const
+{
+	const int32 NumSlots = SlotFrames.Num();
+	return (Head - (NumRecorded - 1) + LogicalIndex + NumSlots) % NumSlots;
+}
+
+int32 UGasXAttributeHistoryComponent::FindSlot(uint64 Frame) const
+{
+	if (NumRecorded == 0 || Frame < GetOldestFrame())
+	{
+		return INDEX_NONE;
+	}
+
+	const uint64 NewestFrame = SlotFrames[Head];
+	if (Frame >= NewestFrame)
+	{
+		return Head;
+	}
+
+	// WHY: Ticking records every frame, so the slot is usually a fixed distance back from the head
+	const uint64 FramesBack = NewestFrame - Frame;
+	if (FramesBack < static_cast<uint64>(NumRecorded))
+	{
+		const int32 Slot = LogicalToSlot(NumRecorded - 1 - static_cast<int32>(FramesBack));
+		if (SlotFrames[Slot] == Frame)
+		{
+			return Slot;
+		}
+	}
+
+	// NOTE: Hitches or manual recording leave gaps; fall back to a binary search for the newest record <= Frame
+	int32 Low = 0;
+	int32 High = NumRecorded - 1;
+	while (Low < High)
+	{
+		const int32 Mid = (Low + High + 1) / 2;
+		if (SlotFrames[LogicalToSlot(Mid)] <= Frame)
+		{
+			Low = Mid;
+		}
+		else
+		{
+			High = Mid - 1;
+		}
+	}
+	return LogicalToSlot(Low);
+}
+
+bool UGasXAttributeHistoryComponent::TryGetValueAtFrame(const FGameplayAttribute& Attribute, uint64 Frame, float& OutCurrentValue) const
+{
+	const int32 AttributeIndex = Attributes.IndexOfByKey(Attribute);
+	const int32 Slot = AttributeIndex != INDEX_NONE ? FindSlot(Frame) : INDEX_NONE;
+	if (Slot == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutCurrentValue = CurrentValues[Slot * Attributes.Num() + AttributeIndex];
+	return true;
+}
+
+bool UGasXAttributeHistoryComponent::TryGetBaseValueAtFrame(const FGameplayAttribute& Attribute, uint64 Frame, float& OutBaseValue) const
+{
+	const int32 AttributeIndex = Attributes.IndexOfByKey(Attribute);
+	const int32 Slot = AttributeIndex != INDEX_NONE ? FindSlot(Frame) : INDEX_NONE;
+	if (Slot == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutBaseValue = BaseValues[Slot * Attributes.Num() + AttributeIndex];
+	return true;
+}
+
+bool UGasXAttributeHistoryComponent::TryGetDirtyMaskAtFrame(uint64 Frame, uint64& OutDirtyMask) const
+{
+	const int32 Slot = FindSlot(Frame);
+	if (Slot == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutDirtyMask = SlotDirtyMasks[Slot];
+	return true;
+}
+
+bool UGasXAttributeHistoryComponent::RestoreToFrame(uint64 Frame)
+{
+	UAbilitySystemComponent* ASC = BoundASC.Get();
+	UAttributeSet* Set = BoundSet.Get();
+	const int32 Slot = FindSlot(Frame);
+	if (!ASC || !Set || Slot == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const float* Base = BaseValues.GetData() + Slot * Attributes.Num();
+	for (int32 Index = 0; Index < Attributes.Num(); ++Index)
+	{
+		// WHY: Writing unchanged attributes would still fire change delegates and dirty replication
+		if (Attributes[Index].GetGameplayAttributeData(Set)->GetBaseValue() != Base[Index])
+		{
+			ASC->SetNumericAttributeBase(Attributes[Index], Base[Index]);
+		}
+	}
+	return true;
+}
+
+void UGasXAttributeHistoryComponent::ClearHistory()
+{
+	Head = INDEX_NONE;
+	NumRecorded = 0;
+}
+
+uint64 UGasXAttributeHistoryComponent::GetOldestFrame() const
+{
+	return NumRecorded > 0 ? SlotFrames[LogicalToSlot(0)] : 0;
+}
+
+uint64 UGasXAttributeHistoryComponent::GetNewestFrame() const
+{
+	return NumRecorded > 0 ? SlotFrames[Head] : 0;
+}
@@ -0,0 +1,586 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXAttributeJournal.h"
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "GameFramework/Actor.h"
+#include "GameplayEffect.h"
+#include "GameplayEffectExtension.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/Archive.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXJournal, Log, All);
+
+namespace GasXJournal
+{
+	/** 'GXJ1' */
+	static constexpr uint32 FileMagic = 0x314A5847;
+	static constexpr uint32 FileVersion = 1;
+
+	/** Record tags. Names are written once per file and referenced by index afterwards. */
+	static constexpr uint8 NameRecord = 0;
+	static constexpr uint8 ChangeRecord = 1;
+
+	static TAutoConsoleVariable<FString> CVarSampleRates(
+		TEXT("GasX.Journal.SampleRates"), TEXT(""),
+		TEXT("Per-attribute sampling rates applied at GasX.Journal.Start, e.g. \"Health=1,Stamina=0.05\""));
+
+	static TAutoConsoleVariable<float> CVarDefaultSampleRate(
+		TEXT("GasX.Journal.DefaultSampleRate"), 1.0f,
+		TEXT("Sampling rate for attributes not listed in GasX.Journal.SampleRates"));
+
+	static TAutoConsoleVariable<int32> CVarMaxFileMB(
+		TEXT("GasX.Journal.MaxFileMB"), 64,
+		TEXT("Journal file size that triggers rotation to a new file"));
+
+	static TAutoConsoleVariable<int32> CVarMaxFiles(
+		TEXT("GasX.Journal.MaxFiles"), 8,
+		TEXT("Journal files kept in the journal directory; older ones are deleted on rotation"));
+
+	static TAutoConsoleVariable<int32> CVarFlushIntervalMs(
+		TEXT("GasX.Journal.FlushIntervalMs"), 100,
+		TEXT("How often the journal writer thread drains the ring"));
+
+	/** Value before the executing effect; Pre/PostGameplayEffectExecute run back to back on one thread. */
+	static thread_local float PendingOldValue = 0.0f;
+}
+
+/**
+ * Background thread that drains the journal ring into rotating files.
+ */
+class FGasXJournalWriter : public FRunnable
+{
+public:
+	FGasXJournalWriter(FGasXAttributeJournal& InJournal, const FString& InDirectory)
+		: Journal(InJournal)
+		, Directory(InDirectory)
+	{
+	}
+
+	virtual ~FGasXJournalWriter() override
+	{
+		StopAndJoin();
+	}
+
+	bool Launch()
+	{
+		if (!OpenNextFile())
+		{
+			return false;
+		}
+
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+		Thread = FRunnableThread::Create(this, TEXT("GasXJournalWriter"), 0, TPri_BelowNormal);
+		if (!Thread)
+		{
+			CloseFile();
+			return false;
+		}
+		return true;
+	}
+
+	void StopAndJoin()
+	{
+		if (Thread)
+		{
+			Stop();
+			Thread->WaitForCompletion();
+			delete Thread;
+			Thread = nullptr;
+		}
+		if (WakeEvent)
+		{
+			FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+			WakeEvent = nullptr;
+		}
+	}
+
+	virtual uint32 Run() override
+	{
+		while (!bStopRequested.load(std::memory_order_relaxed))
+		{
+			if (!Drain())
+			{
+				WakeEvent->Wait(FMath::Max(1, GasXJournal::CVarFlushIntervalMs.GetValueOnAnyThread()));
+			}
+		}
+
+		// WHY: Producers stopped before the stop request, so one last drain empties the ring
+		Drain();
+		CloseFile();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopRequested.store(true, std::memory_order_relaxed);
+		if (WakeEvent)
+		{
+			WakeEvent->Trigger();
+		}
+	}
+
+	FString GetCurrentFilePath() const
+	{
+		FScopeLock Lock(&PathLock);
+		return CurrentFilePath;
+	}
+
+private:
+	/** Write everything queued. Returns false if the ring was empty. */
+	bool Drain()
+	{
+		bool bWroteAny = false;
+		FGasXJournalEntry Entry;
+		while (File && Journal.TryPop(Entry))
+		{
+			WriteEntry(Entry);
+			bWroteAny = true;
+
+			const int64 MaxBytes = static_cast<int64>(FMath::Max(1, GasXJournal::CVarMaxFileMB.GetValueOnAnyThread())) * 1024 * 1024;
+			if (File->Tell() >= MaxBytes)
+			{
+				CloseFile();
+				OpenNextFile();
+			}
+		}
+
+		if (bWroteAny && File)
+		{
+			File->Flush();
+		}
+		return bWroteAny;
+	}
+
+	void WriteEntry(const FGasXJournalEntry& Entry)
+	{
+		uint32 WhoIndex = GetNameIndex(Entry.Who);
+		uint32 AttributeIndex = GetNameIndex(Entry.Attribute);
+		uint32 CauseIndex = GetNameIndex(Entry.Cause);
+
+		uint8 Tag = GasXJournal::ChangeRecord;
+		uint64 Frame = Entry.Frame;
+		uint32 WhoId = Entry.WhoId;
+		float OldValue = Entry.OldValue;
+		float NewValue = Entry.NewValue;
+		*File << Tag << Frame << WhoIndex << WhoId << AttributeIndex << CauseIndex << OldValue << NewValue;
+
+		Journal.NumWritten.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	uint32 GetNameIndex(FName Name)
+	{
+		if (const uint32* Existing = NameIndices.Find(Name))
+		{
+			return *Existing;
+		}
+
+		uint32 Index = NameIndices.Num();
+		NameIndices.Add(Name, Index);
+
+		uint8 Tag = GasXJournal::NameRecord;
+		FString NameString = Name.ToString();
+		*File << Tag << Index << NameString;
+		return Index;
+	}
+
+	bool OpenNextFile()
+	{
+		const FString FileName = FString::Printf(TEXT("GasXJournal_%s_%03d.gxj"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d-%H%M%S")), FileSequence++);
+		const FString FilePath = Directory / FileName;
+
+		File.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+		if (!File)
+		{
+			UE_LOG(LogGasXJournal, Error, TEXT("Could not open journal file %s"), *FilePath);
+			return false;
+		}
+
+		uint32 Magic = GasXJournal::FileMagic;
+		uint32 Version = GasXJournal::FileVersion;
+		*File << Magic << Version;
+		NameIndices.Reset();
+
+		{
+			FScopeLock Lock(&PathLock);
+			CurrentFilePath = FilePath;
+		}
+
+		PruneOldFiles();
+		return true;
+	}
+
+	void CloseFile()
+	{
+		if (File)
+		{
+			File->Close();
+			File.Reset();
+		}
+	}
+
+	void PruneOldFiles() const
+	{
+		TArray<FString> Files;
+		IFileManager::Get().FindFiles(Files, *(Directory / TEXT("GasXJournal_*.gxj")), /*Files*/ true, /*Directories*/ false);
+
+		// NOTE: Names start with a UTC timestamp, so lexical order is age order
+		Files.Sort();
+		const int32 NumToDelete = Files.Num() - FMath::Max(1, GasXJournal::CVarMaxFiles.GetValueOnAnyThread());
+		for (int32 Index = 0; Index < NumToDelete; ++Index)
+		{
+			IFileManager::Get().Delete(*(Directory / Files[Index]));
+		}
+	}
+
+	FGasXAttributeJournal& Journal;
+	const FString Directory;
+
+	TUniquePtr<FArchive> File;
+	TMap<FName, uint32> NameIndices;
+	int32 FileSequence = 0;
+
+	mutable FCriticalSection PathLock;
+	FString CurrentFilePath;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	std::atomic<bool> bStopRequested{false};
+};
+
+struct FGasXAttributeJournal::FProducerScope
+{
+	explicit FProducerScope(FGasXAttributeJournal& InJournal)
+		: Journal(InJournal)
+	{
+		// WHY: Sequentially consistent with Stop(): either Stop() sees this producer and waits, or the producer sees it stopped
+		Journal.NumActiveProducers.fetch_add(1, std::memory_order_seq_cst);
+		bActive = Journal.bRunning.load(std::memory_order_seq_cst);
+	}
+
+	~FProducerScope()
+	{
+		Journal.NumActiveProducers.fetch_sub(1, std::memory_order_release);
+	}
+
+	FGasXAttributeJournal& Journal;
+	bool bActive = false;
+};
+
+FGasXAttributeJournal& FGasXAttributeJournal::Get()
+{
+	static FGasXAttributeJournal Journal;
+	return Journal;
+}
+
+FGasXAttributeJournal::FGasXAttributeJournal() = default;
+
+FGasXAttributeJournal::~FGasXAttributeJournal()
+{
+	Stop();
+}
+
+bool FGasXAttributeJournal::Start(const FString& Directory)
+{
+	check(IsInGameThread());
+	if (IsRunning())
+	{
+		return true;
+	}
+
+	if (!IFileManager::Get().MakeDirectory(*Directory, /*Tree*/ true))
+	{
+		UE_LOG(LogGasXJournal, Error, TEXT("Could not create journal directory %s"), *Directory);
+		return false;
+	}
+
+	// WHY: Rates are parsed once so producers read them without locking
+	SampleRates.Reset();
+	TArray<FString> RateEntries;
+	GasXJournal::CVarSampleRates.GetValueOnGameThread().ParseIntoArray(RateEntries, TEXT(","));
+	for (const FString& RateEntry : RateEntries)
+	{
+		FString AttributeName, Rate;
+		if (RateEntry.Split(TEXT("="), &AttributeName, &Rate))
+		{
+			SampleRates.Add(FName(*AttributeName.TrimStartAndEnd()), FCString::Atof(*Rate));
+		}
+		else
+		{
+			UE_LOG(LogGasXJournal, Warning, TEXT("Ignoring malformed sample rate '%s' (expected Attribute=Rate)"), *RateEntry);
+		}
+	}
+	DefaultSampleRate = GasXJournal::CVarDefaultSampleRate.GetValueOnGameThread();
+
+	if (!Slots)
+	{
+		Slots = MakeUnique<FSlot[]>(Capacity);
+	}
+	for (uint32 Index = 0; Index < Capacity; ++Index)
+	{
+		Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+	}
+	EnqueuePos.store(0, std::memory_order_relaxed);
+	DequeuePos = 0;
+	NumDropped.store(0, std::memory_order_relaxed);
+	NumWritten.store(0, std::memory_order_relaxed);
+
+	Writer = MakeUnique<FGasXJournalWriter>(*this, Directory);
+	if (!Writer->Launch())
+	{
+		Writer.Reset();
+		return false;
+	}
+
+	bRunning.store(true, std::memory_order_release);
+	UE_LOG(LogGasXJournal, Log, TEXT("Attribute journal writing to %s"), *Writer->GetCurrentFilePath());
+	return true;
+}
+
+void FGasXAttributeJournal::Stop()
+{
+	if (!Writer)
+	{
+		return;
+	}
+
+	bRunning.store(false, std::memory_order_seq_cst);
+
+	// WHY: A producer that claimed a slot before the flag flipped must finish writing it before the final drain,
+	// and before a later Start() resets the ring under it. Producers never block, so this wait is short.
+	while (NumActiveProducers.load(std::memory_order_acquire) != 0)
+	{
+		FPlatformProcess::Yield();
+	}
+
+	Writer->StopAndJoin();
+	Writer.Reset();
+
+	UE_LOG(LogGasXJournal, Log, TEXT("Attribute journal stopped: %llu written, %llu dropped"), GetNumWritten(), GetNumDropped());
+}
+
+FString FGasXAttributeJournal::GetCurrentFilePath() const
+{
+	return Writer ? Writer->GetCurrentFilePath() : FString();
+}
+
+bool FGasXAttributeJournal::Append(const FGasXJournalEntry& Entry)
+{
+	const FProducerScope Producer(*this);
+	if (!Producer.bActive)
+	{
+		return false;
+	}
+
+	// NOTE: Bounded MPSC ring: each slot's sequence says whether it is free for position Pos (== Pos),
+	// holds an unread entry (== Pos + 1), or has not been read since the previous lap (< Pos)
+	uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		FSlot& Slot = Slots[Pos & (Capacity - 1)];
+		const uint64 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+		const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Pos);
+		if (Difference == 0)
+		{
+			if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+			{
+				Slot.Entry = Entry;
+				Slot.Sequence.store(Pos + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (Difference < 0)
+		{
+			// WHY: Dropping is cheaper than ever making the game thread wait on disk
+			NumDropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else
+		{
+			Pos = EnqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+bool FGasXAttributeJournal::TryPop(FGasXJournalEntry& OutEntry)
+{
+	FSlot& Slot = Slots[DequeuePos & (Capacity - 1)];
+	if (Slot.Sequence.load(std::memory_order_acquire) != DequeuePos + 1)
+	{
+		return false;
+	}
+
+	OutEntry = Slot.Entry;
+	Slot.Sequence.store(DequeuePos + Capacity, std::memory_order_release);
+	++DequeuePos;
+	return true;
+}
+
+bool FGasXAttributeJournal::ShouldSample(FName Attribute)
+{
+	const float* Rate = SampleRates.Find(Attribute);
+	const float SampleRate = Rate ? *Rate : DefaultSampleRate;
+	if (SampleRate >= 1.0f)
+	{
+		return true;
+	}
+	if (SampleRate <= 0.0f)
+	{
+		return false;
+	}
+
+	// WHY: A multiplicative hash of a shared counter spreads accepted samples evenly without a shared RNG
+	const uint32 Hash = SampleCounter.fetch_add(1, std::memory_order_relaxed) * 2654435761u;
+	return Hash < static_cast<uint32>(SampleRate * static_cast<float>(MAX_uint32));
+}
+
+void FGasXAttributeJournal::RecordForOwner(const AActor* Owner, FName Attribute, float OldValue, float NewValue, FName Cause)
+{
+	FGasXAttributeJournal& Journal = Get();
+
+	// NOTE: Covers the sample rate lookup too; Start() rewrites the rates while no producer is active
+	const FProducerScope Producer(Journal);
+	if (!Producer.bActive || OldValue == NewValue || !Owner || !Owner->HasAuthority() || !Journal.ShouldSample(Attribute))
+	{
+		return;
+	}
+
+	FGasXJournalEntry Entry;
+	Entry.Frame = GFrameCounter;
+	Entry.Who = Owner->GetFName();
+	Entry.WhoId = Owner->GetUniqueID();
+	Entry.Attribute = Attribute;
+	Entry.Cause = Cause;
+	Entry.OldValue = OldValue;
+	Entry.NewValue = NewValue;
+	Journal.Append(Entry);
+}
+
+void FGasXAttributeJournal::Record(const UAttributeSet* Set, const FGameplayAttribute& Attribute, float OldValue, float NewValue, FName Cause)
+{
+	if (!Get().IsRunning() || !Set)
+	{
+		return;
+	}
+
+	const FProperty* Property = Attribute.GetUProperty();
+	RecordForOwner(Set->GetOwningActor(), Property ? Property->GetFName() : NAME_None, OldValue, NewValue, Cause);
+}
+
+void FGasXAttributeJournal::BeginEffectExecute(const FGameplayEffectModCallbackData& Data)
+{
+	if (Get().IsRunning())
+	{
+		GasXJournal::PendingOldValue = Data.Target.GetNumericAttributeBase(Data.EvaluatedData.Attribute);
+	}
+}
+
+void FGasXAttributeJournal::EndEffectExecute(const FGameplayEffectModCallbackData& Data)
+{
+	if (!Get().IsRunning())
+	{
+		return;
+	}
+
+	const FProperty* Property = Data.EvaluatedData.Attribute.GetUProperty();
+	const UGameplayEffect* Effect = Data.EffectSpec.Def;
+	RecordForOwner(
+		Data.Target.GetOwnerActor(),
+		Property ? Property->GetFName() : NAME_None,
+		GasXJournal::PendingOldValue,
+		Data.Target.GetNumericAttributeBase(Data.EvaluatedData.Attribute),
+		Effect ? Effect->GetClass()->GetFName() : NAME_None);
+}
+
+bool FGasXAttributeJournal::ReadFile(const FString& FilePath, TArray<FGasXJournalEntry>& OutEntries)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	*Reader << Magic << Version;
+	if (Magic != GasXJournal::FileMagic || Version != GasXJournal::FileVersion)
+	{
+		UE_LOG(LogGasXJournal, Error, TEXT("%s is not a GasX journal file"), *FilePath);
+		return false;
+	}
+
+	TArray<FName> Names;
+	while (!Reader->AtEnd() && !Reader->IsError())
+	{
+		uint8 Tag = 0;
+		*Reader << Tag;
+		if (Tag == GasXJournal::NameRecord)
+		{
+			uint32 Index = 0;
+			FString NameString;
+			*Reader << Index << NameString;
+			Names.SetNum(FMath::Max(Names.Num(), static_cast<int32>(Index) + 1));
+			Names[Index] = FName(*NameString);
+			continue;
+		}
+
+		if (Tag != GasXJournal::ChangeRecord)
+		{
+			UE_LOG(LogGasXJournal, Error, TEXT("%s: unknown record tag %d"), *FilePath, Tag);
+			return false;
+		}
+
+		uint32 WhoIndex = 0, AttributeIndex = 0, CauseIndex = 0;
+		FGasXJournalEntry& Entry = OutEntries.AddDefaulted_GetRef();
+		*Reader << Entry.Frame << WhoIndex << Entry.WhoId << AttributeIndex << CauseIndex << Entry.OldValue << Entry.NewValue;
+		if (!Names.IsValidIndex(WhoIndex) || !Names.IsValidIndex(AttributeIndex) || !Names.IsValidIndex(CauseIndex))
+		{
+			UE_LOG(LogGasXJournal, Error, TEXT("%s: change record references an undefined name"), *FilePath);
+			return false;
+		}
+		Entry.Who = Names[WhoIndex];
+		Entry.Attribute = Names[AttributeIndex];
+		Entry.Cause = Names[CauseIndex];
+	}
+
+	return !Reader->IsError();
+}
+
+namespace GasXJournal
+{
+	static void StartCommand(const TArray<FString>& Args)
+	{
+		const FString Directory = Args.Num() > 0 ? Args[0] : FPaths::ProjectSavedDir() / TEXT("GasXJournal");
+		FGasXAttributeJournal::Get().Start(Directory);
+	}
+
+	static void StatsCommand()
+	{
+		const FGasXAttributeJournal& Journal = FGasXAttributeJournal::Get();
+		UE_LOG(LogGasXJournal, Display, TEXT("Journal %s: %llu written, %llu dropped, file %s"),
+			Journal.IsRunning() ? TEXT("running") : TEXT("stopped"), Journal.GetNumWritten(), Journal.GetNumDropped(), *Journal.GetCurrentFilePath());
+	}
+
+	static FAutoConsoleCommand StartCmd(
+		TEXT("GasX.Journal.Start"),
+		TEXT("Start journaling attribute changes. Usage: GasX.Journal.Start [Directory] (default Saved/GasXJournal)"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&StartCommand));
+
+	static FAutoConsoleCommand StopCmd(
+		TEXT("GasX.Journal.Stop"),
+		TEXT("Flush and stop the attribute journal"),
+		FConsoleCommandDelegate::CreateLambda([]() { FGasXAttributeJournal::Get().Stop(); }));
+
+	static FAutoConsoleCommand StatsCmd(
+		TEXT("GasX.Journal.Stats"),
+		TEXT("Log attribute journal counters"),
+		FConsoleCommandDelegate::CreateStatic(&StatsCommand));
+}
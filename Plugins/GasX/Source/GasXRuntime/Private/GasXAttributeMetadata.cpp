@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXAttributeMetadata.h"
+
+#if WITH_EDITOR
+
+namespace GasXAttributeMetadata
+{
+	template <typename ValueType>
+	bool MergeField(ValueType& Current, ValueType& Snapshot, const ValueType& Generated, bool bHasSnapshot)
+	{
+		bool bChanged = false;
+
+		const bool bDesignerEdited = bHasSnapshot && !(Current == Snapshot);
+		if (!bDesignerEdited && !(Current == Generated))
+		{
+			Current = Generated;
+			bChanged = true;
+		}
+
+		if (!(Snapshot == Generated))
+		{
+			Snapshot = Generated;
+			bChanged = true;
+		}
+
+		return bChanged;
+	}
+}
+
+void FGasXAttributeMetadataRow::RecordGeneratedSnapshot()
+{
+	GeneratedBaseValue = BaseValue;
+	GeneratedMinValue = MinValue;
+	GeneratedMaxValue = MaxValue;
+	GeneratedDescription = Description;
+	bHasGeneratedSnapshot = true;
+}
+
+bool FGasXAttributeMetadataRow::MergeGeneratedValues(const FGasXAttributeMetadataRow& Generated)
+{
+	bool bChanged = false;
+	bChanged |= GasXAttributeMetadata::MergeField(BaseValue, GeneratedBaseValue, Generated.BaseValue, bHasGeneratedSnapshot);
+	bChanged |= GasXAttributeMetadata::MergeField(MinValue, GeneratedMinValue, Generated.MinValue, bHasGeneratedSnapshot);
+	bChanged |= GasXAttributeMetadata::MergeField(MaxValue, GeneratedMaxValue, Generated.MaxValue, bHasGeneratedSnapshot);
+	bChanged |= GasXAttributeMetadata::MergeField(Description, GeneratedDescription, Generated.Description, bHasGeneratedSnapshot);
+
+	if (!bHasGeneratedSnapshot)
+	{
+		bHasGeneratedSnapshot = true;
+		bChanged = true;
+	}
+
+	return bChanged;
+}
+
+#endif // WITH_EDITOR
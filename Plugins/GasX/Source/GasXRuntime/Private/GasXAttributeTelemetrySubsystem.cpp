@@ -0,0 +1,376 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXAttributeTelemetrySubsystem.h"
+#include "AttributeSet.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXTelemetry, Log, All);
+
+CSV_DEFINE_CATEGORY(GasXTelemetry, true);
+
+DECLARE_STATS_GROUP(TEXT("GasX Telemetry"), STATGROUP_GasXTelemetry, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Snapshot"), STAT_GasXTelemetrySnapshot, STATGROUP_GasXTelemetry);
+DECLARE_CYCLE_STAT(TEXT("Compute"), STAT_GasXTelemetryCompute, STATGROUP_GasXTelemetry);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tracked Sets"), STAT_GasXTelemetryTrackedSets, STATGROUP_GasXTelemetry);
+
+namespace GasXTelemetry
+{
+	static TAutoConsoleVariable<float> CVarIntervalSeconds(
+		TEXT("GasX.Telemetry.IntervalSeconds"), 0.0f,
+		TEXT("Seconds between attribute telemetry snapshots; 0 disables telemetry"));
+
+	static TAutoConsoleVariable<FString> CVarMetrics(
+		TEXT("GasX.Telemetry.Metrics"), TEXT("Health/MaxHealth"),
+		TEXT("Comma list of tracked attributes or Numerator/Denominator ratios, e.g. \"Health/MaxHealth,Mana\""));
+
+	static TAutoConsoleVariable<float> CVarLowThreshold(
+		TEXT("GasX.Telemetry.LowThreshold"), 0.2f,
+		TEXT("Fraction below which a sample counts as low (of 1.0 for ratios, of the observed max otherwise)"));
+
+	static TAutoConsoleVariable<int32> CVarNumBuckets(
+		TEXT("GasX.Telemetry.NumBuckets"), 20,
+		TEXT("Histogram buckets per metric"));
+
+	/** Values per ParallelFor work item; small enough to spread 100k samples, large enough to amortize scheduling. */
+	static constexpr int32 ChunkSize = 4096;
+
+	static void DumpCommand(UWorld* World)
+	{
+		const UGasXAttributeTelemetrySubsystem* Telemetry = World ? World->GetSubsystem<UGasXAttributeTelemetrySubsystem>() : nullptr;
+		if (!Telemetry || Telemetry->GetDistributions().Num() == 0)
+		{
+			UE_LOG(LogGasXTelemetry, Display, TEXT("No attribute telemetry yet (is GasX.Telemetry.IntervalSeconds > 0?)"));
+			return;
+		}
+
+		for (const FGasXAttributeDistribution& Distribution : Telemetry->GetDistributions())
+		{
+			UE_LOG(LogGasXTelemetry, Display, TEXT("%s: n=%d min=%.3f mean=%.3f max=%.3f p50=%.3f p90=%.3f p99=%.3f low=%d"),
+				*Distribution.Metric.ToString(), Distribution.Count, Distribution.Min, Distribution.Mean, Distribution.Max,
+				Distribution.P50, Distribution.P90, Distribution.P99, Distribution.NumLow);
+
+			TArray<FString> Buckets;
+			for (const int32 Bucket : Distribution.Buckets)
+			{
+				Buckets.Add(FString::FromInt(Bucket));
+			}
+			UE_LOG(LogGasXTelemetry, Display, TEXT("  histogram: [%s]"), *FString::Join(Buckets, TEXT(" ")));
+		}
+	}
+
+	static FAutoConsoleCommandWithWorld DumpCmd(
+		TEXT("GasX.Telemetry.Dump"),
+		TEXT("Log the latest attribute distributions"),
+		FConsoleCommandWithWorldDelegate::CreateStatic(&DumpCommand));
+}
+
+void UGasXAttributeTelemetrySubsystem::RegisterSet(const UAttributeSet* Set)
+{
+	if (Set)
+	{
+		Sets.Add(Set);
+	}
+}
+
+bool UGasXAttributeTelemetrySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UGasXAttributeTelemetrySubsystem::Deinitialize()
+{
+	if (PendingTask.IsValid())
+	{
+		PendingTask.Wait();
+		PendingTask = {};
+	}
+	Sets.Reset();
+	MetricPropertiesByClass.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UGasXAttributeTelemetrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGasXAttributeTelemetrySubsystem, STATGROUP_Tickables);
+}
+
+void UGasXAttributeTelemetrySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingTask.IsValid() && PendingTask.IsCompleted())
+	{
+		PublishResults(MoveTemp(PendingTask.GetResult()));
+		PendingTask = {};
+	}
+
+	const float IntervalSeconds = GasXTelemetry::CVarIntervalSeconds.GetValueOnGameThread();
+	if (IntervalSeconds <= 0.0f)
+	{
+		return;
+	}
+
+	TimeSinceSnapshot += DeltaTime;
+
+	// NOTE: Skip a snapshot rather than queue a second one behind a slow computation
+	if (TimeSinceSnapshot < IntervalSeconds || PendingTask.IsValid())
+	{
+		return;
+	}
+	TimeSinceSnapshot = 0.0;
+
+	FSnapshot Snapshot;
+	TakeSnapshot(Snapshot);
+	if (Snapshot.MetricNames.Num() == 0)
+	{
+		return;
+	}
+
+	PendingTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Snapshot = MoveTemp(Snapshot)]() mutable
+	{
+		SCOPE_CYCLE_COUNTER(STAT_GasXTelemetryCompute);
+
+		TArray<FGasXAttributeDistribution> Results;
+		for (int32 Index = 0; Index < Snapshot.MetricNames.Num(); ++Index)
+		{
+			Results.Add(ComputeDistribution(Snapshot.MetricNames[Index], Snapshot.Values[Index], Snapshot.RatioMetrics[Index], Snapshot.LowThreshold, Snapshot.NumBuckets));
+		}
+		return Results;
+	});
+}
+
+void UGasXAttributeTelemetrySubsystem::RefreshMetrics()
+{
+	const FString Spec = GasXTelemetry::CVarMetrics.GetValueOnGameThread();
+	if (Spec == MetricsSpec)
+	{
+		return;
+	}
+
+	MetricsSpec = Spec;
+	Metrics.Reset();
+	MetricPropertiesByClass.Reset();
+
+	TArray<FString> Entries;
+	Spec.ParseIntoArray(Entries, TEXT(","));
+	for (FString& Entry : Entries)
+	{
+		Entry.TrimStartAndEndInline();
+
+		FMetric& Metric = Metrics.AddDefaulted_GetRef();
+		Metric.Name = FName(*Entry);
+
+		FString Numerator, Denominator;
+		if (Entry.Split(TEXT("/"), &Numerator, &Denominator))
+		{
+			Metric.Numerator = FName(*Numerator.TrimStartAndEnd());
+			Metric.Denominator = FName(*Denominator.TrimStartAndEnd());
+		}
+		else
+		{
+			Metric.Numerator = Metric.Name;
+		}
+	}
+}
+
+const TArray<TPair<FProperty*, FProperty*>>& UGasXAttributeTelemetrySubsystem::GetMetricProperties(const UClass* SetClass)
+{
+	if (const TArray<TPair<FProperty*, FProperty*>>* Cached = MetricPropertiesByClass.Find(SetClass))
+	{
+		return *Cached;
+	}
+
+	auto FindAttributeProperty = [SetClass](FName Name) -> FProperty*
+	{
+		FProperty* Property = Name.IsNone() ? nullptr : FindFProperty<FProperty>(SetClass, Name);
+		return Property && FGameplayAttribute::IsGameplayAttributeDataProperty(Property) ? Property : nullptr;
+	};
+
+	TArray<TPair<FProperty*, FProperty*>>& Properties = MetricPropertiesByClass.Add(SetClass);
+	for (const FMetric& Metric : Metrics)
+	{
+		FProperty* Numerator = FindAttributeProperty(Metric.Numerator);
+		FProperty* Denominator = FindAttributeProperty(Metric.Denominator);
+
+		// WHY: A ratio is only meaningful when both halves live on the same set
+		if (!Metric.Denominator.IsNone() && !Denominator)
+		{
+			Numerator = nullptr;
+		}
+		Properties.Emplace(Numerator, Denominator);
+	}
+	return Properties;
+}
+
+void UGasXAttributeTelemetrySubsystem::TakeSnapshot(FSnapshot& OutSnapshot)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GasXTelemetrySnapshot);
+
+	RefreshMetrics();
+
+	for (auto It = Sets.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	SET_DWORD_STAT(STAT_GasXTelemetryTrackedSets, Sets.Num());
+
+	OutSnapshot.LowThreshold = GasXTelemetry::CVarLowThreshold.GetValueOnGameThread();
+	OutSnapshot.NumBuckets = FMath::Clamp(GasXTelemetry::CVarNumBuckets.GetValueOnGameThread(), 1, 1000);
+	OutSnapshot.Values.SetNum(Metrics.Num());
+	for (const FMetric& Metric : Metrics)
+	{
+		OutSnapshot.MetricNames.Add(Metric.Name);
+		OutSnapshot.RatioMetrics.Add(!Metric.Denominator.IsNone());
+	}
+	for (TArray<float>& Values : OutSnapshot.Values)
+	{
+		Values.Reserve(Sets.Num());
+	}
+
+	for (const TWeakObjectPtr<const UAttributeSet>& WeakSet : Sets)
+	{
+		const UAttributeSet* Set = WeakSet.Get();
+		const TArray<TPair<FProperty*, FProperty*>>& Properties = GetMetricProperties(Set->GetClass());
+		for (int32 Index = 0; Index < Properties.Num(); ++Index)
+		{
+			const FProperty* Numerator = Properties[Index].Key;
+			if (!Numerator)
+			{
+				continue;
+			}
+
+			float Value = Numerator->ContainerPtrToValuePtr<FGameplayAttributeData>(Set)->GetCurrentValue();
+			if (const FProperty* Denominator = Properties[Index].Value)
+			{
+				const float DenominatorValue = Denominator->ContainerPtrToValuePtr<FGameplayAttributeData>(Set)->GetCurrentValue();
+				if (DenominatorValue == 0.0f)
+				{
+					continue;
+				}
+				Value /= DenominatorValue;
+			}
+			OutSnapshot.Values[Index].Add(Value);
+		}
+	}
+}
+
+void UGasXAttributeTelemetrySubsystem::PublishResults(TArray<FGasXAttributeDistribution>&& Results)
+{
+	Distributions = MoveTemp(Results);
+
+#if CSV_PROFILER
+	if (FCsvProfiler::Get()->IsCapturing())
+	{
+		for (const FGasXAttributeDistribution& Distribution : Distributions)
+		{
+			const FString Metric = Distribution.Metric.ToString();
+			const uint32 Category = CSV_CATEGORY_INDEX(GasXTelemetry);
+			FCsvProfiler::RecordCustomStat(FName(*(Metric + TEXT("_Mean"))), Category, Distribution.Mean, ECsvCustomStatOp::Set);
+			FCsvProfiler::RecordCustomStat(FName(*(Metric + TEXT("_P50"))), Category, Distribution.P50, ECsvCustomStatOp::Set);
+			FCsvProfiler::RecordCustomStat(FName(*(Metric + TEXT("_P90"))), Category, Distribution.P90, ECsvCustomStatOp::Set);
+			FCsvProfiler::RecordCustomStat(FName(*(Metric + TEXT("_Low"))), Category, static_cast<float>(Distribution.NumLow), ECsvCustomStatOp::Set);
+		}
+	}
+#endif
+}
+
+FGasXAttributeDistribution UGasXAttributeTelemetrySubsystem::ComputeDistribution(FName Metric, TArray<float>& Values, bool bRatio, float LowThreshold, int32 NumBuckets)
+{
+	FGasXAttributeDistribution Result;
+	Result.Metric = Metric;
+	Result.Count = Values.Num();
+	Result.Buckets.SetNumZeroed(FMath::Max(1, NumBuckets));
+	if (Values.Num() == 0)
+	{
+		return Result;
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(Values.Num(), GasXTelemetry::ChunkSize);
+	auto GetChunkValues = [&Values](int32 Chunk)
+	{
+		const int32 Start = Chunk * GasXTelemetry::ChunkSize;
+		return TConstArrayView<float>(Values.GetData() + Start, FMath::Min(GasXTelemetry::ChunkSize, Values.Num() - Start));
+	};
+
+	// Pass 1: range and sum, one cache-line-aligned partial result per chunk so workers never share a line of output
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FChunkRange
+	{
+		float Min = MAX_flt;
+		float Max = -MAX_flt;
+		double Sum = 0.0;
+	};
+	TArray<FChunkRange> Ranges;
+	Ranges.SetNum(NumChunks);
+	ParallelFor(NumChunks, [&Ranges, &GetChunkValues](int32 Chunk)
+	{
+		FChunkRange& Range = Ranges[Chunk];
+		for (const float Value : GetChunkValues(Chunk))
+		{
+			Range.Min = FMath::Min(Range.Min, Value);
+			Range.Max = FMath::Max(Range.Max, Value);
+			Range.Sum += Value;
+		}
+	});
+
+	Result.Min = MAX_flt;
+	Result.Max = -MAX_flt;
+	double Sum = 0.0;
+	for (const FChunkRange& Range : Ranges)
+	{
+		Result.Min = FMath::Min(Result.Min, Range.Min);
+		Result.Max = FMath::Max(Result.Max, Range.Max);
+		Sum += Range.Sum;
+	}
+	Result.Mean = static_cast<float>(Sum / Values.Num());
+
+	// Pass 2: histogram and low count against the merged range
+	const int32 BucketCount = Result.Buckets.Num();
+	const float Span = Result.Max - Result.Min;
+	const float LowLimit = LowThreshold * (bRatio ? 1.0f : Result.Max);
+	// NOTE: Each chunk's row holds its buckets then its low count, padded to whole cache lines in an aligned allocation
+	const int32 RowStride = Align(BucketCount + 1, PLATFORM_CACHE_LINE_SIZE / static_cast<int32>(sizeof(int32)));
+	TArray<int32, TAlignedHeapAllocator<PLATFORM_CACHE_LINE_SIZE>> ChunkCounts;
+	ChunkCounts.SetNumZeroed(NumChunks * RowStride);
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		int32* Row = ChunkCounts.GetData() + Chunk * RowStride;
+		for (const float Value : GetChunkValues(Chunk))
+		{
+			const int32 Bucket = Span > 0.0f ? FMath::Min(BucketCount - 1, static_cast<int32>((Value - Result.Min) / Span * BucketCount)) : 0;
+			++Row[Bucket];
+			Row[BucketCount] += Value < LowLimit ? 1 : 0;
+		}
+	});
+
+	for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+	{
+		const int32* Row = ChunkCounts.GetData() + Chunk * RowStride;
+		for (int32 Bucket = 0; Bucket < BucketCount; ++Bucket)
+		{
+			Result.Buckets[Bucket] += Row[Bucket];
+		}
+		Result.NumLow += Row[BucketCount];
+	}
+
+	// Percentiles by nearest rank
+	Values.Sort();
+	auto Percentile = [&Values](double Fraction)
+	{
+		const int32 Rank = FMath::Clamp(FMath::CeilToInt32(Fraction * Values.Num()) - 1, 0, Values.Num() - 1);
+		return Values[Rank];
+	};
+	Result.P50 = Percentile(0.5);
+	Result.P90 = Percentile(0.9);
+	Result.P99 = Percentile(0.99);
+
+	return Result;
+}
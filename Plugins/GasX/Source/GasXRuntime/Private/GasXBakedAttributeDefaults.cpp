@@ -0,0 +1,171 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXBakedAttributeDefaults.h"
+#include "Engine/DataTable.h"
+#include "GasXAttributeMetadata.h"
+
+#if WITH_EDITOR
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/ObjectSaveContext.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXBakedDefaults, Log, All);
+
+void UGasXBakedAttributeDefaults::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	// WHY: FBulkData asserts if serialized while locked; saves after a runtime lookup would otherwise hit it
+	ReleaseValues();
+
+	// WHY: Ask for file mapping so cooked payloads can be mapped read-only instead of copied per process
+	ValueBulkData.Serialize(Ar, this, INDEX_NONE, /*bAttemptFileMapping*/ true, sizeof(FGasXBakedAttributeDefault));
+}
+
+void UGasXBakedAttributeDefaults::BeginDestroy()
+{
+	ReleaseValues();
+	Super::BeginDestroy();
+}
+
+const FGasXBakedAttributeDefault* UGasXBakedAttributeDefaults::Find(FName TableName, FName RowName) const
+{
+	const FGasXBakedTableRange* Range = Tables.FindByPredicate([TableName](const FGasXBakedTableRange& Candidate) { return Candidate.TableName == TableName; });
+	if (!Range)
+	{
+		return nullptr;
+	}
+
+	const TConstArrayView<FGasXBakedAttributeDefault> Values = GetValues();
+	for (int32 Index = Range->FirstRow; Index < Range->FirstRow + Range->NumRows; ++Index)
+	{
+		// NOTE: Sets have a handful of attributes, so a scan over FName indices beats building a map per process
+		if (RowNames[Index] == RowName && Values.IsValidIndex(Index))
+		{
+			return &Values[Index];
+		}
+	}
+
+	return nullptr;
+}
+
+TConstArrayView<FGasXBakedAttributeDefault> UGasXBakedAttributeDefaults::GetValues() const
+{
+	const int64 NumBytes = ValueBulkData.GetBulkDataSize();
+	if (NumBytes <= 0)
+	{
+		return TConstArrayView<FGasXBakedAttributeDefault>();
+	}
+
+	if (!bValuesLocked)
+	{
+		// WHY: The read-only lock is kept until the next save or load, so lookups stay a pointer into the mapped payload
+		ResolvedValues = static_cast<const FGasXBakedAttributeDefault*>(ValueBulkData.LockReadOnly());
+		bValuesLocked = true;
+	}
+
+	return TConstArrayView<FGasXBakedAttributeDefault>(ResolvedValues, static_cast<int32>(NumBytes / sizeof(FGasXBakedAttributeDefault)));
+}
+
+void UGasXBakedAttributeDefaults::ReleaseValues() const
+{
+	if (bValuesLocked)
+	{
+		ValueBulkData.Unlock();
+		bValuesLocked = false;
+	}
+	ResolvedValues = nullptr;
+}
+
+#if WITH_EDITOR
+void UGasXBakedAttributeDefaults::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	ReleaseValues();
+
+	// WHY: The cook is the bake step; shipped defaults always match the metadata tables being cooked
+	if (SaveContext.IsCooking())
+	{
+		BakeAllMetadataTables();
+	}
+}
+
+void UGasXBakedAttributeDefaults::Bake(TConstArrayView<const UDataTable*> SourceTables)
+{
+	ReleaseValues();
+
+	Tables.Reset();
+	RowNames.Reset();
+	Descriptions.Reset();
+
+	TArray<FGasXBakedAttributeDefault> Values;
+	for (const UDataTable* Table : SourceTables)
+	{
+		if (!Table || Table->GetRowStruct() != FGasXAttributeMetadataRow::StaticStruct())
+		{
+			continue;
+		}
+
+		FGasXBakedTableRange& Range = Tables.AddDefaulted_GetRef();
+		Range.TableName = Table->GetFName();
+		Range.FirstRow = RowNames.Num();
+
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			const FGasXAttributeMetadataRow* MetadataRow = reinterpret_cast<const FGasXAttributeMetadataRow*>(Row.Value);
+
+			FGasXBakedAttributeDefault& Value = Values.AddDefaulted_GetRef();
+			Value.BaseValue = static_cast<float>(MetadataRow->BaseValue);
+			Value.MinValue = static_cast<float>(MetadataRow->MinValue);
+			Value.MaxValue = static_cast<float>(MetadataRow->MaxValue);
+
+			RowNames.Add(Row.Key);
+			Descriptions.Add(MetadataRow->Description);
+		}
+
+		Range.NumRows = RowNames.Num() - Range.FirstRow;
+	}
+
+	// WHY: Keep the payload out of the export and flag it for memory mapping on platforms that support it
+	ValueBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload | BULKDATA_MemoryMappedPayload);
+	ValueBulkData.Lock(LOCK_READ_WRITE);
+	void* Dest = ValueBulkData.Realloc(Values.Num() * sizeof(FGasXBakedAttributeDefault));
+	if (Values.Num() > 0)
+	{
+		FMemory::Memcpy(Dest, Values.GetData(), Values.Num() * sizeof(FGasXBakedAttributeDefault));
+	}
+	ValueBulkData.Unlock();
+
+	UE_LOG(LogGasXBakedDefaults, Log, TEXT("Baked %d attribute defaults from %d metadata table(s) into %s"), Values.Num(), Tables.Num(), *GetPathName());
+}
+
+void UGasXBakedAttributeDefaults::BakeAllMetadataTables()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	TArray<FAssetData> TableAssets;
+	AssetRegistry.GetAssetsByClass(UDataTable::StaticClass()->GetClassPathName(), TableAssets);
+
+	// WHY: Sort by path so the baked layout is deterministic across machines and cooks
+	TableAssets.Sort([](const FAssetData& A, const FAssetData& B) { return A.GetSoftObjectPath().ToString() < B.GetSoftObjectPath().ToString(); });
+
+	TArray<const UDataTable*> MetadataTables;
+	for (const FAssetData& Asset : TableAssets)
+	{
+		// NOTE: RowStructure is a registry tag, so non-metadata tables are filtered without loading them
+		FString RowStructure;
+		if (Asset.GetTagValue(TEXT("RowStructure"), RowStructure) && !RowStructure.Contains(TEXT("GasXAttributeMetadataRow")))
+		{
+			continue;
+		}
+
+		if (const UDataTable* Table = Cast<UDataTable>(Asset.GetAsset()))
+		{
+			MetadataTables.Add(Table);
+		}
+	}
+
+	Bake(MetadataTables);
+}
+#endif // WITH_EDITOR
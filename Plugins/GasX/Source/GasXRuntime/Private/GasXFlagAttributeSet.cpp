@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXFlagAttributeSet.h"
+#include "Net/UnrealNetwork.h"
+
+void UGasXFlagAttributeSet::SetFlagBits(uint64 Mask, bool bValue)
+{
+	BaseFlagBits = bValue ? (BaseFlagBits | Mask) : (BaseFlagBits & ~Mask);
+	UpdateFlagBits();
+}
+
+void UGasXFlagAttributeSet::UpdateFlagBits()
+{
+	const uint64 OldFlagBits = FlagBits;
+	FlagBits = BaseFlagBits | GrantedFlagBits;
+
+	if (FlagBits != OldFlagBits)
+	{
+		OnFlagsChanged.Broadcast(FlagBits ^ OldFlagBits, FlagBits);
+	}
+}
+
+void UGasXFlagAttributeSet::AddFlagGrant(uint64 Mask)
+{
+	for (int32 Bit = 0; Bit < MaxFlags; ++Bit)
+	{
+		if (Mask & (1ull << Bit))
+		{
+			++GrantCounts[Bit];
+		}
+	}
+
+	GrantedFlagBits |= Mask;
+	UpdateFlagBits();
+}
+
+void UGasXFlagAttributeSet::RemoveFlagGrant(uint64 Mask)
+{
+	uint64 ReleasedMask = 0;
+	for (int32 Bit = 0; Bit < MaxFlags; ++Bit)
+	{
+		if ((Mask & (1ull << Bit)) && GrantCounts[Bit] > 0 && --GrantCounts[Bit] == 0)
+		{
+			ReleasedMask |= 1ull << Bit;
+		}
+	}
+
+	// WHY: Only drop the grant; bits that are also set in the base (schema default or an instant effect) stay set
+	GrantedFlagBits &= ~ReleasedMask;
+	UpdateFlagBits();
+}
+
+uint64 UGasXFlagAttributeSet::FindFlagMask(FName FlagName) const
+{
+	const int32 Index = GetFlagNames().IndexOfByKey(FlagName);
+	return Index == INDEX_NONE ? 0 : 1ull << Index;
+}
+
+void UGasXFlagAttributeSet::InitFlagBits(uint64 InDefaultFlagBits)
+{
+	FlagBits = InDefaultFlagBits;
+	BaseFlagBits = InDefaultFlagBits;
+	DefaultFlagBits = InDefaultFlagBits;
+}
+
+void UGasXFlagAttributeSet::ResetFlagBits()
+{
+	// WHY: Grants belong to effects that are still active and will call RemoveFlagGrant() when they end;
+	// dropping their counts here would let those removals clear grants made after the reset
+	BaseFlagBits = DefaultFlagBits;
+	UpdateFlagBits();
+}
+
+void UGasXFlagAttributeSet::OnRep_FlagBits(uint64 OldFlagBits)
+{
+	// NOTE: Clients hold no grants, so the replicated bits are their base
+	BaseFlagBits = FlagBits;
+
+	// WHY: One notification carrying the change mask, so listeners test only the bits they care about
+	if (FlagBits != OldFlagBits)
+	{
+		OnFlagsChanged.Broadcast(FlagBits ^ OldFlagBits, FlagBits);
+	}
+}
+
+void UGasXFlagAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME_CONDITION_NOTIFY(UGasXFlagAttributeSet, FlagBits, COND_None, REPNOTIFY_OnChanged);
+}
@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXFlagEffects.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GasXFlagAttributeSet.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXFlagEffects, Log, All);
+
+bool UGasXFlagsGameplayEffectComponent::OnActiveGameplayEffectAdded(FActiveGameplayEffectsContainer& ActiveGEContainer, FActiveGameplayEffect& ActiveGE) const
+{
+	// WHY: Flags replicate from the server; predicted client copies of the effect must not touch them
+	if (!ActiveGEContainer.IsNetAuthority())
+	{
+		return true;
+	}
+
+	UGasXFlagAttributeSet* FlagSet = FindFlagSet(ActiveGEContainer.Owner);
+	if (!FlagSet)
+	{
+		return true;
+	}
+
+	FlagSet->AddFlagGrant(ResolveMask(*FlagSet, SetFlags));
+	ActiveGE.EventSet.OnEffectRemoved.AddUObject(this, &UGasXFlagsGameplayEffectComponent::OnActiveGameplayEffectRemoved, &ActiveGEContainer);
+	return true;
+}
+
+void UGasXFlagsGameplayEffectComponent::OnGameplayEffectExecuted(FActiveGameplayEffectsContainer& ActiveGEContainer, FGameplayEffectSpec& GESpec, FPredictionKey& PredictionKey) const
+{
+	// NOTE: Periodic executions of duration effects are covered by the grant made when the effect was added
+	if (!ActiveGEContainer.IsNetAuthority() || !GESpec.Def || GESpec.Def->DurationPolicy != EGameplayEffectDurationType::Instant)
+	{
+		return;
+	}
+
+	if (UGasXFlagAttributeSet* FlagSet = FindFlagSet(ActiveGEContainer.Owner))
+	{
+		FlagSet->SetFlagBits(ResolveMask(*FlagSet, SetFlags), true);
+		FlagSet->SetFlagBits(ResolveMask(*FlagSet, ClearFlags), false);
+	}
+}
+
+void UGasXFlagsGameplayEffectComponent::OnActiveGameplayEffectRemoved(const FGameplayEffectRemovalInfo& RemovalInfo, FActiveGameplayEffectsContainer* ActiveGEContainer) const
+{
+	if (UGasXFlagAttributeSet* FlagSet = ActiveGEContainer ? FindFlagSet(ActiveGEContainer->Owner) : nullptr)
+	{
+		FlagSet->RemoveFlagGrant(ResolveMask(*FlagSet, SetFlags));
+	}
+}
+
+UGasXFlagAttributeSet* UGasXFlagsGameplayEffectComponent::FindFlagSet(const UAbilitySystemComponent* AbilitySystem) const
+{
+	if (!AbilitySystem || !AttributeSetClass)
+	{
+		return nullptr;
+	}
+
+	for (UAttributeSet* Set : AbilitySystem->GetSpawnedAttributes())
+	{
+		if (Set && Set->IsA(AttributeSetClass))
+		{
+			return CastChecked<UGasXFlagAttributeSet>(Set);
+		}
+	}
+
+	UE_LOG(LogGasXFlagEffects, Warning, TEXT("%s: %s has no %s"), *GetNameSafe(GetOwner()), *GetNameSafe(AbilitySystem->GetOwner()), *AttributeSetClass->GetName());
+	return nullptr;
+}
+
+uint64 UGasXFlagsGameplayEffectComponent::ResolveMask(const UGasXFlagAttributeSet& FlagSet, const TArray<FName>& FlagNames) const
+{
+	uint64 Mask = 0;
+	for (const FName FlagName : FlagNames)
+	{
+		const uint64 FlagMask = FlagSet.FindFlagMask(FlagName);
+		if (FlagMask == 0)
+		{
+			UE_LOG(LogGasXFlagEffects, Warning, TEXT("%s: %s declares no flag '%s'"), *GetNameSafe(GetOwner()), *FlagSet.GetClass()->GetName(), *FlagName.ToString());
+		}
+		Mask |= FlagMask;
+	}
+	return Mask;
+}
+
+float UGasXFlagMagnitudeCalculation::CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const
+{
+	const UAbilitySystemComponent* Source = Spec.GetContext().GetInstigatorAbilitySystemComponent();
+	if (!Source || !AttributeSetClass)
+	{
+		return ClearMagnitude;
+	}
+
+	for (const UAttributeSet* Set : Source->GetSpawnedAttributes())
+	{
+		if (Set && Set->IsA(AttributeSetClass))
+		{
+			const UGasXFlagAttributeSet* FlagSet = CastChecked<UGasXFlagAttributeSet>(Set);
+			const uint64 FlagMask = FlagSet->FindFlagMask(FlagName);
+			return FlagMask != 0 && FlagSet->TestFlagBits(FlagMask) ? SetMagnitude : ClearMagnitude;
+		}
+	}
+
+	return ClearMagnitude;
+}
@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXInitAttributeRegistry.h"
+
+FGasXInitAttributeRegistry& FGasXInitAttributeRegistry::Get()
+{
+	// WHY: Function-local static so registration from other translation units is safe during static init
+	static FGasXInitAttributeRegistry Registry;
+	return Registry;
+}
+
+void FGasXInitAttributeRegistry::Register(FStaticClassFunc StaticClassFunc, FDescribeFunc DescribeFunc)
+{
+	if (!StaticClassFunc || !DescribeFunc)
+	{
+		return;
+	}
+
+	Unregister(StaticClassFunc);
+
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.StaticClassFunc = StaticClassFunc;
+	Entry.DescribeFunc = DescribeFunc;
+	++Serial;
+}
+
+void FGasXInitAttributeRegistry::Unregister(FStaticClassFunc StaticClassFunc)
+{
+	if (Entries.RemoveAll([StaticClassFunc](const FEntry& Entry) { return Entry.StaticClassFunc == StaticClassFunc; }) > 0)
+	{
+		++Serial;
+	}
+}
+
+const TArray<FGasXInitAttribute>* FGasXInitAttributeRegistry::Find(const UClass* SetClass)
+{
+	if (!SetClass)
+	{
+		return nullptr;
+	}
+
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.StaticClassFunc() != SetClass)
+		{
+			continue;
+		}
+
+		if (!Entry.bDescribed)
+		{
+			Entry.DescribeFunc(Entry.Attributes);
+			Entry.bDescribed = true;
+		}
+		return &Entry.Attributes;
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXLevelCurveSamples.h"
+#include "Engine/CurveTable.h"
+#include "UObject/ObjectKey.h"
+
+namespace GasXLevelCurveSamples
+{
+	struct FCacheEntry
+	{
+		TWeakObjectPtr<UCurveTable> Table;
+		TSharedPtr<const FGasXLevelCurveSamples> Samples;
+		FDelegateHandle ChangedHandle;
+	};
+
+	TMap<FObjectKey, FCacheEntry>& GetCache()
+	{
+		static TMap<FObjectKey, FCacheEntry> Cache;
+		return Cache;
+	}
+}
+
+TSharedPtr<const FGasXLevelCurveSamples> FGasXLevelCurveSamples::Get(UCurveTable* Table)
+{
+	if (!Table)
+	{
+		return nullptr;
+	}
+
+	TMap<FObjectKey, GasXLevelCurveSamples::FCacheEntry>& Cache = GasXLevelCurveSamples::GetCache();
+	const FObjectKey Key(Table);
+
+	GasXLevelCurveSamples::FCacheEntry* Entry = Cache.Find(Key);
+	if (Entry && Entry->Table.IsValid() && Entry->Samples.IsValid())
+	{
+		return Entry->Samples;
+	}
+
+	// WHY: Drop entries for tables that were garbage collected so the cache does not grow across map loads
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Table.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TSharedRef<FGasXLevelCurveSamples> Samples = MakeShared<FGasXLevelCurveSamples>();
+	Samples->Sample(*Table);
+
+	GasXLevelCurveSamples::FCacheEntry& NewEntry = Cache.FindOrAdd(Key);
+	if (!NewEntry.ChangedHandle.IsValid())
+	{
+		NewEntry.ChangedHandle = Table->OnCurveTableChanged().AddLambda([Key]()
+		{
+			if (GasXLevelCurveSamples::FCacheEntry* ChangedEntry = GasXLevelCurveSamples::GetCache().Find(Key))
+			{
+				ChangedEntry->Samples.Reset();
+			}
+		});
+	}
+	NewEntry.Table = Table;
+	NewEntry.Samples = Samples;
+	return Samples;
+}
+
+bool FGasXLevelCurveSamples::TryGetValue(FName RowName, int32 Level, float& OutValue) const
+{
+	const int32* Offset = RowOffsets.Find(RowName);
+	if (!Offset)
+	{
+		return false;
+	}
+
+	OutValue = Values[*Offset + FMath::Clamp(Level, 0, MaxLevel)];
+	return true;
+}
+
+void FGasXLevelCurveSamples::Sample(const UCurveTable& Table)
+{
+	const TMap<FName, FRealCurve*>& RowMap = Table.GetRowMap();
+
+	MaxLevel = 0;
+	for (const TPair<FName, FRealCurve*>& Row : RowMap)
+	{
+		if (Row.Value && Row.Value->GetNumKeys() > 0)
+		{
+			float MinTime = 0.0f;
+			float MaxTime = 0.0f;
+			Row.Value->GetTimeRange(MinTime, MaxTime);
+			MaxLevel = FMath::Max(MaxLevel, FMath::CeilToInt(MaxTime));
+		}
+	}
+	MaxLevel = FMath::Clamp(MaxLevel, 0, MaxSampledLevel);
+
+	const int32 SamplesPerRow = MaxLevel + 1;
+	RowOffsets.Reset();
+	Values.Reset(RowMap.Num() * SamplesPerRow);
+
+	for (const TPair<FName, FRealCurve*>& Row : RowMap)
+	{
+		if (!Row.Value)
+		{
+			continue;
+		}
+
+		RowOffsets.Add(Row.Key, Values.Num());
+		for (int32 Level = 0; Level <= MaxLevel; ++Level)
+		{
+			Values.Add(Row.Value->Eval(static_cast<float>(Level)));
+		}
+	}
+}
@@ -0,0 +1,232 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXLiveTuningSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/CurveTable.h"
+#include "Engine/DataTable.h"
+#include "Engine/World.h"
+#include "GasXAttributeMetadata.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXLiveTuning, Log, All);
+
+namespace GasXLiveTuning
+{
+	static TAutoConsoleVariable<float> CVarBudgetMs(
+		TEXT("GasX.LiveTuning.BudgetMs"), 0.5f,
+		TEXT("Game thread time per frame spent applying live tuning changes to actors"));
+
+	/** Targets processed between budget checks, so the clock is not read for every actor. */
+	static constexpr int32 TargetsPerBudgetCheck = 16;
+
+	static void ImportJsonCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (Args.Num() < 2)
+		{
+			UE_LOG(LogGasXLiveTuning, Error, TEXT("Usage: GasX.LiveTuning.ImportJson <DataTable object path> <json file>"));
+			return;
+		}
+
+		UDataTable* Table = LoadObject<UDataTable>(nullptr, *Args[0]);
+		if (!Table || Table->GetRowStruct() != FGasXAttributeMetadataRow::StaticStruct())
+		{
+			UE_LOG(LogGasXLiveTuning, Error, TEXT("%s is not an attribute metadata DataTable"), *Args[0]);
+			return;
+		}
+
+		FString Json;
+		if (!FFileHelper::LoadFileToString(Json, *Args[1]))
+		{
+			UE_LOG(LogGasXLiveTuning, Error, TEXT("Could not read %s"), *Args[1]);
+			return;
+		}
+
+		for (const FString& Problem : Table->CreateTableFromJSONString(Json))
+		{
+			UE_LOG(LogGasXLiveTuning, Warning, TEXT("%s: %s"), *Table->GetName(), *Problem);
+		}
+
+		// WHY: Watchers react to the change broadcast, exactly as for an editor edit
+		Table->HandleDataTableChanged();
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs ImportJsonCmd(
+		TEXT("GasX.LiveTuning.ImportJson"),
+		TEXT("Reload an attribute metadata DataTable from JSON and roll the changed values out to live actors. Usage: GasX.LiveTuning.ImportJson <DataTable path> <json file>"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ImportJsonCommand));
+}
+
+void UGasXLiveTuningSubsystem::RegisterTarget(UAbilitySystemComponent* ASC, UDataTable* MetadataTable, UCurveTable* LevelCurves)
+{
+	if (!ASC || !MetadataTable || !ASC->IsOwnerActorAuthoritative())
+	{
+		return;
+	}
+
+	FWatchedTable* Watched = WatchedTables.FindByPredicate([MetadataTable](const FWatchedTable& Existing) { return Existing.Table == MetadataTable; });
+	if (!Watched)
+	{
+		Watched = &WatchedTables.AddDefaulted_GetRef();
+		Watched->Table = MetadataTable;
+		Watched->BaseValues = SnapshotBaseValues(*MetadataTable);
+		Watched->ChangedHandle = MetadataTable->OnDataTableChanged().AddUObject(this, &UGasXLiveTuningSubsystem::OnTableChanged, TWeakObjectPtr<UDataTable>(MetadataTable));
+	}
+
+	// WHY: Respawns re-run the bootstrap on the same ASC; drop dead targets while we are here
+	Watched->Targets.RemoveAll([ASC](const FTarget& Target) { return !Target.ASC.IsValid() || Target.ASC == ASC; });
+	Watched->Targets.Add({ASC, LevelCurves});
+}
+
+int32 UGasXLiveTuningSubsystem::GetNumPendingTargets() const
+{
+	int32 NumPending = 0;
+	for (const FRollout& Rollout : Rollouts)
+	{
+		NumPending += Rollout.Targets.Num() - Rollout.NextTarget;
+	}
+	return NumPending;
+}
+
+bool UGasXLiveTuningSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UGasXLiveTuningSubsystem::Deinitialize()
+{
+	for (const FWatchedTable& Watched : WatchedTables)
+	{
+		if (UDataTable* Table = Watched.Table.Get())
+		{
+			Table->OnDataTableChanged().Remove(Watched.ChangedHandle);
+		}
+	}
+	WatchedTables.Reset();
+	Rollouts.Reset();
+
+	Super::Deinitialize();
+}
+
+void UGasXLiveTuningSubsystem::OnTableChanged(TWeakObjectPtr<UDataTable> Table)
+{
+	FWatchedTable* Watched = WatchedTables.FindByPredicate([&Table](const FWatchedTable& Existing) { return Existing.Table == Table; });
+	if (!Watched || !Table.IsValid())
+	{
+		return;
+	}
+
+	TMap<FName, double> NewBaseValues = SnapshotBaseValues(*Table);
+
+	// NOTE: Only base values are pushed; removed rows leave live values alone since there is nothing to apply
+	FRollout Rollout;
+	for (const TPair<FName, double>& Row : NewBaseValues)
+	{
+		const double* OldValue = Watched->BaseValues.Find(Row.Key);
+		if (!OldValue || *OldValue != Row.Value)
+		{
+			Rollout.ChangedValues.Add(Row.Key, {Row.Value, OldValue ? TOptional<double>(*OldValue) : TOptional<double>()});
+		}
+	}
+	Watched->BaseValues = MoveTemp(NewBaseValues);
+
+	Watched->Targets.RemoveAll([](const FTarget& Target) { return !Target.ASC.IsValid(); });
+	if (Rollout.ChangedValues.Num() == 0 || Watched->Targets.Num() == 0)
+	{
+		return;
+	}
+
+	Rollout.Targets = Watched->Targets;
+	UE_LOG(LogGasXLiveTuning, Log, TEXT("%s changed: rolling %d value(s) out to %d actor(s)"), *Table->GetName(), Rollout.ChangedValues.Num(), Rollout.Targets.Num());
+	Rollouts.Add(MoveTemp(Rollout));
+}
+
+void UGasXLiveTuningSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = FMath::Max(0.0f, GasXLiveTuning::CVarBudgetMs.GetValueOnGameThread()) / 1000.0;
+
+	// WHY: Always make some progress, even with a zero budget, so a rollout cannot stall forever
+	int32 NumApplied = 0;
+	while (Rollouts.Num() > 0)
+	{
+		FRollout& Rollout = Rollouts[0];
+		while (Rollout.NextTarget < Rollout.Targets.Num())
+		{
+			ApplyRollout(Rollout, Rollout.Targets[Rollout.NextTarget++]);
+
+			if (++NumApplied % GasXLiveTuning::TargetsPerBudgetCheck == 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			{
+				return;
+			}
+		}
+
+		Rollouts.RemoveAt(0);
+	}
+}
+
+bool UGasXLiveTuningSubsystem::IsTickable() const
+{
+	return Rollouts.Num() > 0;
+}
+
+TStatId UGasXLiveTuningSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGasXLiveTuningSubsystem, STATGROUP_Tickables);
+}
+
+void UGasXLiveTuningSubsystem::ApplyRollout(const FRollout& Rollout, const FTarget& Target) const
+{
+	UAbilitySystemComponent* ASC = Target.ASC.Get();
+	if (!ASC)
+	{
+		return;
+	}
+
+	const UCurveTable* LevelCurves = Target.LevelCurves.Get();
+	for (const UAttributeSet* Set : ASC->GetSpawnedAttributes())
+	{
+		if (!Set)
+		{
+			continue;
+		}
+
+		for (const TPair<FName, TPair<double, TOptional<double>>>& Change : Rollout.ChangedValues)
+		{
+			// WHY: Metadata rows are named after the attribute, the same match the universal init effect uses
+			FProperty* Property = FindFProperty<FProperty>(Set->GetClass(), Change.Key);
+			if (!Property || !FGameplayAttribute::IsGameplayAttributeDataProperty(Property))
+			{
+				continue;
+			}
+
+			if (LevelCurves && LevelCurves->GetRowMap().Contains(Change.Key))
+			{
+				continue;
+			}
+
+			// WHY: Shift by the change in default rather than overwriting, so gameplay state such as damage taken survives a retune
+			const FGameplayAttribute Attribute(Property);
+			const double NewDefault = Change.Value.Key;
+			const double OldDefault = Change.Value.Value.IsSet()
+				? Change.Value.Value.GetValue()
+				: Attribute.GetGameplayAttributeData(Set->GetClass()->GetDefaultObject<UAttributeSet>())->GetBaseValue();
+
+			ASC->SetNumericAttributeBase(Attribute, ASC->GetNumericAttributeBase(Attribute) + static_cast<float>(NewDefault - OldDefault));
+		}
+	}
+}
+
+TMap<FName, double> UGasXLiveTuningSubsystem::SnapshotBaseValues(const UDataTable& Table)
+{
+	TMap<FName, double> BaseValues;
+	Table.ForeachRow<FGasXAttributeMetadataRow>(TEXT("GasXLiveTuning"), [&BaseValues](const FName& RowName, const FGasXAttributeMetadataRow& Row)
+	{
+		BaseValues.Add(RowName, Row.BaseValue);
+	});
+	return BaseValues;
+}
@@ -2,6 +2,7 @@
 
 #include "Modules/ModuleManager.h"
 #include "Logging/LogMacros.h"
+#include "GasXAttributeJournal.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogGasXRuntime, Log, All);
 
@@ -15,6 +16,9 @@ public:
 
 	virtual void ShutdownModule() override
 	{
+		// WHY: Join the writer thread while the engine is still up rather than during static destruction
+		FGasXAttributeJournal::Get().Stop();
+
 		UE_LOG(LogGasXRuntime, Log, TEXT("GasXRuntime module shutting down"));
 	}
 };
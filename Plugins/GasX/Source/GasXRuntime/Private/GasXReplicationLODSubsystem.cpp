@@ -0,0 +1,288 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXReplicationLODSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Net/Core/Misc/NetConditionGroupManager.h"
+#include "Net/NetworkSubsystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXReplicationLOD, Log, All);
+
+namespace GasXReplicationLOD
+{
+	static TAutoConsoleVariable<float> CVarEvaluateHz(
+		TEXT("GasX.ReplicationLOD.EvaluateHz"), 10.0f,
+		TEXT("How often attribute replication LOD re-buckets viewers; a far refresh stays open for at least one evaluation period"));
+
+	static TAutoConsoleVariable<bool> CVarEnabled(
+		TEXT("GasX.ReplicationLOD.Enabled"), true,
+		TEXT("If false, every registered set replicates to every viewer at full rate"));
+}
+
+bool UGasXReplicationLODSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UGasXReplicationLODSubsystem::Deinitialize()
+{
+	for (FManagedActor& Managed : ManagedActors)
+	{
+		Release(Managed);
+	}
+	ManagedActors.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UGasXReplicationLODSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGasXReplicationLODSubsystem, STATGROUP_Tickables);
+}
+
+void UGasXReplicationLODSubsystem::RegisterActor(AActor* Actor, UAbilitySystemComponent* ASC, TConstArrayView<FGasXReplicationLODSetting> Settings)
+{
+	if (!Actor || !ASC || !Actor->HasAuthority() || Settings.Num() == 0)
+	{
+		return;
+	}
+
+	// WHY: COND_NetGroup is only honoured for subobjects replicated through the registered list.
+	// The sets replicate with the actor hosting the ASC, which is the PlayerState for PlayerState-hosted ASCs, not Actor.
+	const AActor* ReplicatingActor = ASC->GetOwner();
+	if (!ReplicatingActor || !ReplicatingActor->IsUsingRegisteredSubObjectList() || !ASC->IsUsingRegisteredSubObjectList())
+	{
+		UE_LOG(LogGasXReplicationLOD, Warning, TEXT("%s does not replicate through the registered subobject list; attribute replication LOD disabled for %s"),
+			ReplicatingActor ? *ReplicatingActor->GetName() : TEXT("null ASC owner"), *Actor->GetName());
+		return;
+	}
+
+	UnregisterActor(Actor);
+
+	UNetworkSubsystem* NetworkSubsystem = GetWorld()->GetSubsystem<UNetworkSubsystem>();
+	if (!NetworkSubsystem)
+	{
+		return;
+	}
+
+	FManagedActor Managed;
+	Managed.Actor = Actor;
+	Managed.ASC = ASC;
+	for (UAttributeSet* Set : ASC->GetSpawnedAttributes())
+	{
+		const FGasXReplicationLODSetting* Setting = Set ? Settings.FindByPredicate([Set](const FGasXReplicationLODSetting& Candidate) { return Candidate.AttributeSetClass.Get() == Set->GetClass(); }) : nullptr;
+		if (!Setting)
+		{
+			continue;
+		}
+
+		FManagedSet& ManagedSet = Managed.Sets.AddDefaulted_GetRef();
+		ManagedSet.Set = Set;
+		ManagedSet.NetGroup = AcquireNetGroup();
+		ManagedSet.FullRateDistanceSquared = FMath::Square(static_cast<double>(Setting->FullRateDistance));
+		ManagedSet.FarUpdateInterval = Setting->FarUpdateInterval;
+
+		// NOTE: The ASC registered the set with COND_None; a subobject cannot be registered twice with different conditions
+		ASC->RemoveReplicatedSubObject(Set);
+		ASC->AddReplicatedSubObject(Set, COND_NetGroup);
+		NetworkSubsystem->GetNetConditionGroupManager().RegisterSubObjectInGroup(Set, ManagedSet.NetGroup);
+	}
+
+	if (Managed.Sets.Num() > 0)
+	{
+		ManagedActors.Add(MoveTemp(Managed));
+
+		// WHY: Viewers start outside every group; evaluate now so nearby viewers do not wait a period for the first update
+		Evaluate(GetWorld()->GetTimeSeconds());
+	}
+}
+
+void UGasXReplicationLODSubsystem::UnregisterActor(AActor* Actor)
+{
+	const int32 Index = ManagedActors.IndexOfByPredicate([Actor](const FManagedActor& Managed) { return Managed.Actor == Actor; });
+	if (Index != INDEX_NONE)
+	{
+		Release(ManagedActors[Index]);
+		ManagedActors.RemoveAtSwap(Index);
+	}
+}
+
+FName UGasXReplicationLODSubsystem::GetNetGroup(const UAttributeSet* Set) const
+{
+	for (const FManagedActor& Managed : ManagedActors)
+	{
+		for (const FManagedSet& ManagedSet : Managed.Sets)
+		{
+			if (ManagedSet.Set == Set)
+			{
+				return ManagedSet.NetGroup;
+			}
+		}
+	}
+	return NAME_None;
+}
+
+FName UGasXReplicationLODSubsystem::AcquireNetGroup()
+{
+	if (FreeNetGroups.Num() > 0)
+	{
+		return FreeNetGroups.Pop(EAllowShrinking::No);
+	}
+
+	// NOTE: Numbered FNames share one name table entry; the number lives in the FName itself
+	return FName(TEXT("GasXLOD"), ++NumNetGroups);
+}
+
+void UGasXReplicationLODSubsystem::Release(FManagedActor& Managed)
+{
+	UNetworkSubsystem* NetworkSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UNetworkSubsystem>() : nullptr;
+	UAbilitySystemComponent* ASC = Managed.ASC.Get();
+
+	for (FManagedSet& ManagedSet : Managed.Sets)
+	{
+		for (const TPair<TWeakObjectPtr<APlayerController>, FViewerState>& Viewer : ManagedSet.Viewers)
+		{
+			if (APlayerController* PlayerController = Viewer.Key.Get(); PlayerController && Viewer.Value.bIncluded)
+			{
+				PlayerController->RemoveFromNetConditionGroup(ManagedSet.NetGroup);
+			}
+		}
+
+		UAttributeSet* Set = ManagedSet.Set.Get();
+		if (Set && ASC)
+		{
+			if (NetworkSubsystem)
+			{
+				NetworkSubsystem->GetNetConditionGroupManager().UnregisterSubObjectFromGroup(Set, ManagedSet.NetGroup);
+			}
+			ASC->RemoveReplicatedSubObject(Set);
+			ASC->AddReplicatedSubObject(Set);
+		}
+
+		FreeNetGroups.Add(ManagedSet.NetGroup);
+	}
+	Managed.Sets.Reset();
+}
+
+void UGasXReplicationLODSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// NOTE: World time, like Evaluate() and the net driver's update scheduling, so dilation and pause affect all of them alike
+	const double Now = GetWorld()->GetTimeSeconds();
+	const float EvaluateHz = FMath::Max(0.1f, GasXReplicationLOD::CVarEvaluateHz.GetValueOnGameThread());
+	if (ManagedActors.Num() > 0 && Now - LastEvaluateTime >= 1.0 / EvaluateHz)
+	{
+		LastEvaluateTime = Now;
+		Evaluate(Now);
+	}
+}
+
+void UGasXReplicationLODSubsystem::Evaluate(double Now)
+{
+	struct FViewer
+	{
+		APlayerController* PlayerController;
+		FVector Location;
+	};
+
+	// NOTE: Local controllers read server objects directly, so only remote viewers are bucketed
+	TArray<FViewer, TInlineAllocator<128>> Viewers;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = It->Get();
+		if (PlayerController && !PlayerController->IsLocalController())
+		{
+			FVector Location;
+			FRotator Rotation;
+			PlayerController->GetPlayerViewPoint(Location, Rotation);
+			Viewers.Add({PlayerController, Location});
+		}
+	}
+
+	const bool bEnabled = GasXReplicationLOD::CVarEnabled.GetValueOnGameThread();
+	NumThrottledPairs = 0;
+
+	for (int32 ActorIndex = ManagedActors.Num() - 1; ActorIndex >= 0; --ActorIndex)
+	{
+		FManagedActor& Managed = ManagedActors[ActorIndex];
+		const AActor* Actor = Managed.Actor.Get();
+		if (!Actor)
+		{
+			Release(Managed);
+			ManagedActors.RemoveAtSwap(ActorIndex);
+			continue;
+		}
+
+		// NOTE: The sets replicate with the ASC's owner, which is not Actor when the ASC lives on the PlayerState
+		const UAbilitySystemComponent* ASC = Managed.ASC.Get();
+		AActor* ReplicatingActor = ASC ? ASC->GetOwner() : nullptr;
+		const double NetUpdatePeriod = ReplicatingActor ? 1.0 / FMath::Max(0.01, static_cast<double>(ReplicatingActor->GetNetUpdateFrequency())) : 0.0;
+		bool bForceNetUpdate = false;
+
+		const FVector ActorLocation = Actor->GetActorLocation();
+		for (FManagedSet& ManagedSet : Managed.Sets)
+		{
+			if (!ManagedSet.Set.IsValid())
+			{
+				continue;
+			}
+
+			for (const FViewer& Viewer : Viewers)
+			{
+				FViewerState& State = ManagedSet.Viewers.FindOrAdd(Viewer.PlayerController);
+
+				bool bInclude = !bEnabled || Actor->IsOwnedBy(Viewer.PlayerController)
+					|| FVector::DistSquared(ActorLocation, Viewer.Location) <= ManagedSet.FullRateDistanceSquared;
+				if (!bInclude && Now < State.FarRefreshUntil)
+				{
+					bInclude = true;
+				}
+				// WHY: A viewer never in the group has no copy of the set, so client lookups and readiness would never complete
+				else if (!bInclude && (!State.bHasBeenIncluded
+					|| (ManagedSet.FarUpdateInterval > 0.0f && Now - State.LastFarRefresh >= ManagedSet.FarUpdateInterval)))
+				{
+					// WHY: Nothing guarantees the owner updates while the viewer is in the group, so force an update
+					// and hold the viewer in for a full net update period of the replicating actor
+					bInclude = true;
+					bForceNetUpdate = true;
+					State.LastFarRefresh = Now;
+					State.FarRefreshUntil = Now + NetUpdatePeriod;
+				}
+
+				if (bInclude != State.bIncluded)
+				{
+					if (bInclude)
+					{
+						Viewer.PlayerController->IncludeInNetConditionGroup(ManagedSet.NetGroup);
+					}
+					else
+					{
+						Viewer.PlayerController->RemoveFromNetConditionGroup(ManagedSet.NetGroup);
+					}
+					State.bIncluded = bInclude;
+				}
+				State.bHasBeenIncluded |= bInclude;
+				NumThrottledPairs += bInclude ? 0 : 1;
+			}
+
+			for (auto It = ManagedSet.Viewers.CreateIterator(); It; ++It)
+			{
+				if (!It->Key.IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		if (bForceNetUpdate && ReplicatingActor)
+		{
+			ReplicatingActor->ForceNetUpdate();
+		}
+	}
+}
@@ -0,0 +1,30 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXResettableAttributeSet.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AttributeSet.h"
+#include "GameFramework/Actor.h"
+
+void IGasXResettableAttributeSet::ResetAttribute(UAttributeSet* Set, const FGameplayAttribute& Attribute, float DefaultValue)
+{
+	// NOTE: Sets are outered to the ASC (bootstrap) or to its owning actor (GAS default subobjects); accept both
+	UObject* Outer = Set->GetOuter();
+	UAbilitySystemComponent* ASC = Cast<UAbilitySystemComponent>(Outer);
+	if (!ASC)
+	{
+		ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Cast<AActor>(Outer));
+	}
+
+	if (ASC && ASC->GetSpawnedAttributes().Contains(Set))
+	{
+		ASC->SetNumericAttributeBase(Attribute, DefaultValue);
+		return;
+	}
+
+	if (FGameplayAttributeData* Data = Attribute.GetGameplayAttributeData(Set))
+	{
+		Data->SetBaseValue(DefaultValue);
+		Data->SetCurrentValue(DefaultValue);
+	}
+}
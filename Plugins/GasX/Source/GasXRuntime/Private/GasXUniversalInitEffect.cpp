@@ -0,0 +1,159 @@
+// Copyright Epic Games, Inc.
+
+#include "GasXUniversalInitEffect.h"
+#include "Engine/DataTable.h"
+#include "GasXAttributeMetadata.h"
+#include "GasXLevelCurveSamples.h"
+#include "GasXBakedAttributeDefaults.h"
+#include "UObject/Package.h"
+
+namespace GasXUniversalInitEffect
+{
+	struct FCache
+	{
+		uint32 RegistrySerial = 0;
+		TMap<FString, UGasXUniversalInitEffect*> Effects;
+
+		void Reset()
+		{
+			for (const TPair<FString, UGasXUniversalInitEffect*>& Pair : Effects)
+			{
+				if (IsValid(Pair.Value))
+				{
+					Pair.Value->RemoveFromRoot();
+				}
+			}
+			Effects.Reset();
+		}
+	};
+
+	FCache& GetCache()
+	{
+		static FCache Cache;
+		return Cache;
+	}
+}
+
+UGasXUniversalInitEffect::UGasXUniversalInitEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+}
+
+UGasXUniversalInitEffect* UGasXUniversalInitEffect::GetForSets(TConstArrayView<const UClass*> SetClasses)
+{
+	FGasXInitAttributeRegistry& Registry = FGasXInitAttributeRegistry::Get();
+
+	TArray<const UClass*> Registered;
+	for (const UClass* SetClass : SetClasses)
+	{
+		if (SetClass && Registry.Find(SetClass))
+		{
+			Registered.AddUnique(SetClass);
+		}
+	}
+
+	if (Registered.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// WHY: Order-independent key so actors listing the same sets in a different order share one effect
+	Registered.Sort([](const UClass& A, const UClass& B) { return A.GetFName().LexicalLess(B.GetFName()); });
+
+	TArray<FString> ClassPaths;
+	for (const UClass* SetClass : Registered)
+	{
+		ClassPaths.Add(SetClass->GetPathName());
+	}
+	const FString Key = FString::Join(ClassPaths, TEXT(";"));
+
+	GasXUniversalInitEffect::FCache& Cache = GasXUniversalInitEffect::GetCache();
+	if (Cache.RegistrySerial != Registry.GetSerial())
+	{
+		// WHY: A module with generated sets was loaded or unloaded; attribute bindings may be stale
+		Cache.Reset();
+		Cache.RegistrySerial = Registry.GetSerial();
+	}
+
+	if (UGasXUniversalInitEffect* const* Existing = Cache.Effects.Find(Key))
+	{
+		if (IsValid(*Existing))
+		{
+			return *Existing;
+		}
+	}
+
+	UGasXUniversalInitEffect* Effect = NewObject<UGasXUniversalInitEffect>(GetTransientPackage(), NAME_None, RF_Transient);
+	Effect->Build(Registered);
+
+	// WHY: Shared across actors and worlds for the lifetime of the process
+	Effect->AddToRoot();
+	Cache.Effects.Add(Key, Effect);
+	return Effect;
+}
+
+void UGasXUniversalInitEffect::Build(TConstArrayView<const UClass*> SetClasses)
+{
+	FGasXInitAttributeRegistry& Registry = FGasXInitAttributeRegistry::Get();
+
+	InitAttributes.Reset();
+	MetadataTableNames.Reset();
+	Modifiers.Reset();
+
+	for (const UClass* SetClass : SetClasses)
+	{
+		const TArray<FGasXInitAttribute>* Attributes = Registry.Find(SetClass);
+		if (!Attributes)
+		{
+			continue;
+		}
+
+		// WHY: Matches the generator's /Game/Generated/Attributes/<Set>Metadata naming
+		const FName MetadataTableName(*(SetClass->GetName() + TEXT("Metadata")));
+
+		for (const FGasXInitAttribute& InitAttribute : *Attributes)
+		{
+			FSetByCallerFloat SetByCaller;
+			SetByCaller.DataTag = InitAttribute.SetByCallerTag;
+
+			FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+			Modifier.Attribute = InitAttribute.Attribute;
+			Modifier.ModifierOp = EGameplayModOp::Override;
+			Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCaller);
+
+			InitAttributes.Add(InitAttribute);
+			MetadataTableNames.Add(MetadataTableName);
+		}
+	}
+}
+
+void UGasXUniversalInitEffect::FillSpec(FGameplayEffectSpec& Spec, const FGasXInitValueSources& Sources) const
+{
+	const UDataTable* MetadataTable = Sources.MetadataTable;
+	if (MetadataTable && MetadataTable->GetRowStruct() != FGasXAttributeMetadataRow::StaticStruct())
+	{
+		MetadataTable = nullptr;
+	}
+
+	for (int32 Index = 0; Index < InitAttributes.Num(); ++Index)
+	{
+		const FGasXInitAttribute& InitAttribute = InitAttributes[Index];
+		const FName RowName(*InitAttribute.Attribute.GetName());
+
+		float Value = InitAttribute.DefaultValue;
+		if (Sources.LevelCurves && Sources.LevelCurves->TryGetValue(RowName, Sources.Level, Value))
+		{
+			// Level curve wins
+		}
+		else if (const FGasXAttributeMetadataRow* Row = MetadataTable ? MetadataTable->FindRow<FGasXAttributeMetadataRow>(RowName, TEXT("GasXUniversalInitEffect"), /*bWarnIfRowMissing*/ false) : nullptr)
+		{
+			Value = static_cast<float>(Row->BaseValue);
+		}
+		else if (const FGasXBakedAttributeDefault* Baked = Sources.BakedDefaults ? Sources.BakedDefaults->Find(MetadataTableNames[Index], RowName) : nullptr)
+		{
+			Value = Baked->BaseValue;
+		}
+
+		Spec.SetSetByCallerMagnitude(InitAttribute.SetByCallerTag, Value);
+	}
+}
@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "GasXAttributeArray.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXAttributeArrayElementWritesTest,
+	"GasX.Runtime.AttributeArray.ElementWrites",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXAttributeArrayElementWritesTest::RunTest(const FString& Parameters)
+{
+	FGasXAttributeArray Resistances;
+	Resistances.Init(TEXT("Resistances"), 8, 10.0f);
+
+	TestEqual(TEXT("Element count"), Resistances.Num(), 8);
+	TestEqual(TEXT("Unwritten element reads the default"), Resistances.GetCurrentValue(5), 10.0f);
+
+	int32 NumNotifications = 0;
+	int32 LastIndex = INDEX_NONE;
+	float LastOldValue = 0.0f;
+	Resistances.OnElementChanged.AddLambda([&](FName ArrayName, int32 Index, float OldValue, float NewValue)
+	{
+		++NumNotifications;
+		LastIndex = Index;
+		LastOldValue = OldValue;
+	});
+
+	const int32 KeyBefore = Resistances.ArrayReplicationKey;
+	Resistances.SetBaseValue(3, 25.0f);
+	TestEqual(TEXT("Written element updated"), Resistances.GetCurrentValue(3), 25.0f);
+	TestEqual(TEXT("Base write sets base value"), Resistances.GetBaseValue(3), 25.0f);
+	TestEqual(TEXT("Neighbouring element untouched"), Resistances.GetCurrentValue(4), 10.0f);
+	TestNotEqual(TEXT("Write dirties the array"), Resistances.ArrayReplicationKey, KeyBefore);
+	TestEqual(TEXT("One notification"), NumNotifications, 1);
+	TestEqual(TEXT("Notification index"), LastIndex, 3);
+	TestEqual(TEXT("Notification old value is the default"), LastOldValue, 10.0f);
+
+	// WHY: Rewriting the same value must not dirty the element, or it would be resent every pass
+	const int32 KeyAfterWrite = Resistances.ArrayReplicationKey;
+	Resistances.SetBaseValue(3, 25.0f);
+	TestEqual(TEXT("No-op write does not dirty the array"), Resistances.ArrayReplicationKey, KeyAfterWrite);
+	TestEqual(TEXT("No-op write does not notify"), NumNotifications, 1);
+
+	Resistances.SetCurrentValue(3, 40.0f);
+	TestEqual(TEXT("Current write keeps the base value"), Resistances.GetBaseValue(3), 25.0f);
+	TestEqual(TEXT("Current write sets current value"), Resistances.GetCurrentValue(3), 40.0f);
+
+	AddExpectedError(TEXT("out of range"), EAutomationExpectedErrorFlags::Contains, 1);
+	Resistances.SetBaseValue(8, 1.0f);
+	TestEqual(TEXT("Out of range write is ignored"), NumNotifications, 2);
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -7,6 +7,7 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Misc/AutomationTest.h"
+#include "Tests/GasXTestActors.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FGasXBootstrapAddsPlayerCoreAttributesTest,
@@ -79,4 +80,91 @@ bool FGasXBootstrapAddsPlayerCoreAttributesTest::RunTest(const FString& Paramete
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXBootstrapResolvesAbilitySystemComponentTest,
+	"GasX.Runtime.Bootstrap.ResolvesAbilitySystemComponent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXBootstrapResolvesAbilitySystemComponentTest::RunTest(const FString& Parameters)
+{
+	// WHY: Covers both interface lookups and the PlayerState case, where the ASC only becomes reachable after BeginPlay
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	auto AddBootstrap = [World](AActor* Owner)
+	{
+		UGasXAttributeBootstrapComponent* Bootstrap = NewObject<UGasXAttributeBootstrapComponent>(Owner);
+		Owner->AddInstanceComponent(Bootstrap);
+		Bootstrap->RegisterComponentWithWorld(World);
+		Bootstrap->TestAddAttributeSetType(UPlayerCoreAttributes::StaticClass());
+		return Bootstrap;
+	};
+
+	auto HasPlayerCoreSet = [](const UAbilitySystemComponent* ASC)
+	{
+		return ASC && ASC->GetSet<UPlayerCoreAttributes>() != nullptr;
+	};
+
+	// Owner implements IAbilitySystemInterface
+	AGasXTestASCActor* InterfaceActor = World->SpawnActor<AGasXTestASCActor>();
+	UGasXAttributeBootstrapComponent* InterfaceBootstrap = AddBootstrap(InterfaceActor);
+	InterfaceBootstrap->RunBootstrapForTests();
+	TestEqual(TEXT("Owner interface ASC is resolved"), InterfaceBootstrap->ResolveAbilitySystemComponent(), InterfaceActor->GetAbilitySystemComponent());
+	TestTrue(TEXT("Sets land on the owner interface ASC"), HasPlayerCoreSet(InterfaceActor->GetAbilitySystemComponent()));
+
+	// Pawn whose ASC lives on the PlayerState: nothing to bootstrap until it is possessed
+	AGasXTestPawn* Pawn = World->SpawnActor<AGasXTestPawn>();
+	UGasXAttributeBootstrapComponent* PawnBootstrap = AddBootstrap(Pawn);
+	PawnBootstrap->RunBootstrapForTests();
+	TestNull(TEXT("No ASC before possession"), PawnBootstrap->ResolveAbilitySystemComponent());
+	TestFalse(TEXT("Bootstrap deferred until possession"), PawnBootstrap->AreAttributesReady());
+
+	auto SpawnPlayer = [World]()
+	{
+		AGasXTestController* Controller = World->SpawnActor<AGasXTestController>();
+		AGasXTestPlayerState* PlayerState = World->SpawnActor<AGasXTestPlayerState>();
+		PlayerState->SetOwner(Controller);
+		Controller->PlayerState = PlayerState;
+		return Controller;
+	};
+
+	AGasXTestController* FirstController = SpawnPlayer();
+	UAbilitySystemComponent* FirstASC = CastChecked<AGasXTestPlayerState>(FirstController->PlayerState)->GetAbilitySystemComponent();
+	FirstController->Possess(Pawn);
+	TestEqual(TEXT("PlayerState interface ASC is resolved after possession"), PawnBootstrap->ResolveAbilitySystemComponent(), FirstASC);
+	TestTrue(TEXT("Sets land on the PlayerState ASC"), HasPlayerCoreSet(FirstASC));
+	TestTrue(TEXT("Ready after deferred bootstrap"), PawnBootstrap->AreAttributesReady());
+
+	// Re-possession by another player must not keep pointing at the first PlayerState's ASC
+	AGasXTestController* SecondController = SpawnPlayer();
+	UAbilitySystemComponent* SecondASC = CastChecked<AGasXTestPlayerState>(SecondController->PlayerState)->GetAbilitySystemComponent();
+	SecondController->Possess(Pawn);
+	TestEqual(TEXT("Re-possession retargets the cached ASC"), PawnBootstrap->ResolveAbilitySystemComponent(), SecondASC);
+	TestTrue(TEXT("Sets land on the new PlayerState ASC"), HasPlayerCoreSet(SecondASC));
+	const UAttributeSet* RetargetedSet = PawnBootstrap->GetOrCreateAttributeSet(UPlayerCoreAttributes::StaticClass());
+	TestTrue(TEXT("GetOrCreateAttributeSet reads the new ASC"), RetargetedSet && RetargetedSet == SecondASC->GetSet<UPlayerCoreAttributes>());
+
+	SecondController->UnPossess();
+	TestEqual(TEXT("Unpossessing keeps the cached ASC"), PawnBootstrap->ResolveAbilitySystemComponent(), SecondASC);
+
+	InterfaceActor->Destroy();
+	Pawn->Destroy();
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
 #endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "GasXAttributeCensus.h"
+#include "AbilitySystemComponent.h"
+#include "Attributes/PlayerCoreAttributes.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXAttributeCensusTest,
+	"GasX.Runtime.Census.CountsSetsAndDefaults",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXAttributeCensusTest::RunTest(const FString& Parameters)
+{
+	// WHY: Capacity planning trusts these numbers; counts and the default fraction must track the live sets exactly
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	TArray<UAbilitySystemComponent*> ASCs;
+	for (int32 Index = 0; Index < 2; ++Index)
+	{
+		AActor* Owner = World->SpawnActor<AActor>();
+		UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Owner);
+		Owner->AddInstanceComponent(ASC);
+		ASC->RegisterComponentWithWorld(World);
+		ASC->AddAttributeSetSubobject(NewObject<UPlayerCoreAttributes>(ASC));
+		ASCs.Add(ASC);
+	}
+	ASCs[0]->SetNumericAttributeBase(UPlayerCoreAttributes::GetHealthAttribute(), 1.0f);
+
+	TArray<FGasXAttributeCensusEntry> Entries;
+	TestEqual(TEXT("Visited every ASC"), FGasXAttributeCensus::Collect(World, Entries), 2);
+
+	const FGasXAttributeCensusEntry* Entry = Entries.FindByPredicate([](const FGasXAttributeCensusEntry& Candidate)
+	{
+		return Candidate.SetClassName == UPlayerCoreAttributes::StaticClass()->GetFName();
+	});
+	if (TestNotNull(TEXT("PlayerCoreAttributes counted"), Entry))
+	{
+		TestEqual(TEXT("Instances"), Entry->NumInstances, 2);
+		// NOTE: PlayerCoreAttributes owns no heap arrays, so anything near twice the class size means it was counted twice
+		const int64 ClassSize = UPlayerCoreAttributes::StaticClass()->GetStructureSize();
+		TestTrue(TEXT("Bytes cover the class size"), Entry->GetBytesPerInstance() >= ClassSize);
+		TestTrue(TEXT("Class size is counted once"), Entry->GetBytesPerInstance() < 2 * ClassSize);
+		TestEqual(TEXT("Attributes"), Entry->NumAttributes, int64(10));
+		TestEqual(TEXT("Only the edited Health differs from default"), Entry->NumAttributesAtDefault, int64(9));
+
+		const FString Csv = FGasXAttributeCensus::ToCsv(Entries);
+		TestTrue(TEXT("CSV has a header"), Csv.StartsWith(TEXT("SetClass,Instances,")));
+		TestTrue(TEXT("CSV has the set row"), Csv.Contains(TEXT("\nPlayerCoreAttributes,2,")));
+	}
+
+	for (UAbilitySystemComponent* ASC : ASCs)
+	{
+		AActor* Owner = ASC->GetOwner();
+		ASC->DestroyComponent();
+		Owner->Destroy();
+	}
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,150 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "GasXAttributeHistoryComponent.h"
+#include "AbilitySystemComponent.h"
+#include "Attributes/PlayerCoreAttributes.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/GasXTestActors.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXAttributeHistoryTest,
+	"GasX.Runtime.History.LookupAndRestore",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXAttributeHistoryTest::RunTest(const FString& Parameters)
+{
+	// WHY: Lag compensation reads values as of past frames and rollback restores them; both must survive wrap-around
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	AActor* Owner = World->SpawnActor<AActor>();
+	UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Owner);
+	Owner->AddInstanceComponent(ASC);
+	ASC->RegisterComponentWithWorld(World);
+	ASC->InitStats(UPlayerCoreAttributes::StaticClass(), nullptr);
+
+	UGasXAttributeHistoryComponent* History = NewObject<UGasXAttributeHistoryComponent>(Owner);
+	History->TestConfigure(UPlayerCoreAttributes::StaticClass(), 4);
+	Owner->AddInstanceComponent(History);
+	History->RegisterComponentWithWorld(World);
+
+	const FGameplayAttribute Health = UPlayerCoreAttributes::GetHealthAttribute();
+
+	// Frames 10..15 with Health 100, 90, ... so only the last four frames stay in the ring
+	for (uint64 Frame = 10; Frame <= 15; ++Frame)
+	{
+		ASC->SetNumericAttributeBase(Health, 100.0f - (Frame - 10) * 10.0f);
+		TestTrue(TEXT("Frame recorded"), History->RecordFrame(Frame));
+	}
+	TestFalse(TEXT("Out-of-order frame rejected"), History->RecordFrame(15));
+
+	TestEqual(TEXT("Oldest frame after wrap"), History->GetOldestFrame(), static_cast<uint64>(12));
+	TestEqual(TEXT("Newest frame"), History->GetNewestFrame(), static_cast<uint64>(15));
+
+	float Value = 0.0f;
+	TestFalse(TEXT("Evicted frame is gone"), History->TryGetValueAtFrame(Health, 11, Value));
+	TestTrue(TEXT("Frame 13 in history"), History->TryGetValueAtFrame(Health, 13, Value));
+	TestEqual(TEXT("Health as of frame 13"), Value, 70.0f);
+
+	uint64 DirtyMask = 0;
+	TestTrue(TEXT("Dirty mask available"), History->TryGetDirtyMaskAtFrame(13, DirtyMask));
+	const int32 HealthBit = History->GetRecordedAttributes().IndexOfByKey(Health);
+	TestEqual(TEXT("Only Health changed in frame 13"), DirtyMask, 1ull << HealthBit);
+
+	// A gap in recording falls back to the newest record before the requested frame
+	ASC->SetNumericAttributeBase(Health, 5.0f);
+	History->RecordFrame(20);
+	TestTrue(TEXT("Frame inside a gap resolves"), History->TryGetValueAtFrame(Health, 18, Value));
+	TestEqual(TEXT("Gap resolves to frame 15"), Value, 50.0f);
+
+	TestTrue(TEXT("Restore succeeds"), History->RestoreToFrame(14));
+	TestEqual(TEXT("Health rolled back"), ASC->GetNumericAttributeBase(Health), 60.0f);
+
+	History->DestroyComponent();
+	ASC->DestroyComponent();
+	Owner->Destroy();
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXAttributeHistoryPlayerStateTest,
+	"GasX.Runtime.History.PlayerStateAbilitySystem",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXAttributeHistoryPlayerStateTest::RunTest(const FString& Parameters)
+{
+	// WHY: Player pawns usually keep their ASC on the PlayerState, which is only reachable once the pawn is possessed
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	AGasXTestPawn* Pawn = World->SpawnActor<AGasXTestPawn>();
+	UGasXAttributeHistoryComponent* History = NewObject<UGasXAttributeHistoryComponent>(Pawn);
+	History->TestConfigure(UPlayerCoreAttributes::StaticClass(), 4);
+	Pawn->AddInstanceComponent(History);
+	History->RegisterComponentWithWorld(World);
+
+	TestFalse(TEXT("Nothing to record before possession"), History->RecordFrame(1));
+
+	AGasXTestController* Controller = World->SpawnActor<AGasXTestController>();
+	AGasXTestPlayerState* PlayerState = World->SpawnActor<AGasXTestPlayerState>();
+	PlayerState->SetOwner(Controller);
+	Controller->PlayerState = PlayerState;
+	UAbilitySystemComponent* ASC = PlayerState->GetAbilitySystemComponent();
+	ASC->InitStats(UPlayerCoreAttributes::StaticClass(), nullptr);
+	Controller->Possess(Pawn);
+
+	const FGameplayAttribute Health = UPlayerCoreAttributes::GetHealthAttribute();
+	ASC->SetNumericAttributeBase(Health, 80.0f);
+	TestTrue(TEXT("Records from the PlayerState ASC"), History->RecordFrame(2));
+
+	ASC->SetNumericAttributeBase(Health, 30.0f);
+	History->RecordFrame(3);
+
+	float Value = 0.0f;
+	TestTrue(TEXT("Frame 2 in history"), History->TryGetValueAtFrame(Health, 2, Value));
+	TestEqual(TEXT("Health as of frame 2"), Value, 80.0f);
+	TestTrue(TEXT("Restore succeeds"), History->RestoreToFrame(2));
+	TestEqual(TEXT("PlayerState ASC rolled back"), ASC->GetNumericAttributeBase(Health), 80.0f);
+
+	Pawn->Destroy();
+	PlayerState->Destroy();
+	Controller->Destroy();
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
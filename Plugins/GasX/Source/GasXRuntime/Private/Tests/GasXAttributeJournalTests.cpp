@@ -0,0 +1,165 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "GasXAttributeJournal.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXAttributeJournalRoundTripTest,
+	"GasX.Runtime.Journal.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXAttributeJournalRoundTripTest::RunTest(const FString& Parameters)
+{
+	// WHY: Entries appended from several threads must all reach disk and read back intact
+	FGasXAttributeJournal& Journal = FGasXAttributeJournal::Get();
+	if (!TestFalse(TEXT("Journal not already running"), Journal.IsRunning()))
+	{
+		return false;
+	}
+
+	const FString Directory = FPaths::AutomationTransientDir() / TEXT("GasXJournal");
+	IFileManager::Get().DeleteDirectory(*Directory, /*RequireExists*/ false, /*Tree*/ true);
+	if (!TestTrue(TEXT("Journal started"), Journal.Start(Directory)))
+	{
+		return false;
+	}
+	const FString FilePath = Journal.GetCurrentFilePath();
+
+	constexpr int32 NumEntries = 1000;
+	ParallelFor(NumEntries, [&Journal](int32 Index)
+	{
+		FGasXJournalEntry Entry;
+		Entry.Frame = Index;
+		Entry.Who = TEXT("GasXJournalTestActor");
+		Entry.WhoId = 7;
+		Entry.Attribute = Index % 2 ? FName(TEXT("Health")) : FName(TEXT("Mana"));
+		Entry.OldValue = static_cast<float>(Index);
+		Entry.NewValue = static_cast<float>(Index + 1);
+		Journal.Append(Entry);
+	});
+
+	Journal.Stop();
+	TestFalse(TEXT("Append after Stop is refused"), Journal.Append(FGasXJournalEntry()));
+	TestEqual(TEXT("Nothing dropped"), Journal.GetNumDropped(), static_cast<uint64>(0));
+	TestEqual(TEXT("Everything written"), Journal.GetNumWritten(), static_cast<uint64>(NumEntries));
+
+	TArray<FGasXJournalEntry> Entries;
+	if (TestTrue(TEXT("Journal file reads back"), FGasXAttributeJournal::ReadFile(FilePath, Entries)))
+	{
+		TestEqual(TEXT("Entry count"), Entries.Num(), NumEntries);
+
+		Entries.Sort([](const FGasXJournalEntry& A, const FGasXJournalEntry& B) { return A.Frame < B.Frame; });
+		const FGasXJournalEntry& Entry = Entries.Last();
+		TestEqual(TEXT("Frame"), Entry.Frame, static_cast<uint64>(NumEntries - 1));
+		TestEqual(TEXT("Who"), Entry.Who, FName(TEXT("GasXJournalTestActor")));
+		TestEqual(TEXT("Attribute"), Entry.Attribute, FName(TEXT("Health")));
+		TestEqual(TEXT("Cause"), Entry.Cause, FName(NAME_None));
+		TestEqual(TEXT("New value"), Entry.NewValue, static_cast<float>(NumEntries));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXAttributeJournalRestartTest,
+	"GasX.Runtime.Journal.RestartWhileProducing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXAttributeJournalRestartTest::RunTest(const FString& Parameters)
+{
+	// WHY: Stop() and Start() reset the ring; producers still pushing across them must never leave a torn entry on disk
+	FGasXAttributeJournal& Journal = FGasXAttributeJournal::Get();
+	if (!TestFalse(TEXT("Journal not already running"), Journal.IsRunning()))
+	{
+		return false;
+	}
+
+	const FString Directory = FPaths::AutomationTransientDir() / TEXT("GasXJournalRestart");
+	IFileManager::Get().DeleteDirectory(*Directory, /*RequireExists*/ false, /*Tree*/ true);
+
+	constexpr int32 NumProducers = 4;
+	constexpr int32 NumSessions = 20;
+	std::atomic<bool> bProducing{true};
+	TArray<TFuture<void>> Producers;
+	for (int32 ProducerIndex = 0; ProducerIndex < NumProducers; ++ProducerIndex)
+	{
+		Producers.Add(Async(EAsyncExecution::Thread, [&Journal, &bProducing]()
+		{
+			// Every field derives from one counter, so a torn copy cannot read back consistent
+			uint64 Counter = 0;
+			while (bProducing.load(std::memory_order_relaxed))
+			{
+				FGasXJournalEntry Entry;
+				Entry.Frame = ++Counter;
+				Entry.Who = TEXT("GasXJournalRestartActor");
+				Entry.WhoId = static_cast<uint32>(Counter);
+				Entry.Attribute = TEXT("Health");
+				Entry.OldValue = static_cast<float>(Counter % 1000);
+				Entry.NewValue = Entry.OldValue + 1.0f;
+				Journal.Append(Entry);
+			}
+		}));
+	}
+
+	TArray<uint64> NumWrittenPerSession;
+	for (int32 Session = 0; Session < NumSessions; ++Session)
+	{
+		// NOTE: One directory per session; file names only have second resolution and restart their sequence
+		if (!TestTrue(TEXT("Journal restarted"), Journal.Start(Directory / FString::FromInt(Session))))
+		{
+			break;
+		}
+		FPlatformProcess::Sleep(0.01f);
+		Journal.Stop();
+		NumWrittenPerSession.Add(Journal.GetNumWritten());
+	}
+
+	bProducing.store(false, std::memory_order_relaxed);
+	for (TFuture<void>& Producer : Producers)
+	{
+		Producer.Wait();
+	}
+
+	int32 NumTorn = 0;
+	for (int32 Session = 0; Session < NumWrittenPerSession.Num(); ++Session)
+	{
+		const FString SessionDirectory = Directory / FString::FromInt(Session);
+		TArray<FString> Files;
+		IFileManager::Get().FindFiles(Files, *(SessionDirectory / TEXT("*.gxj")), /*Files*/ true, /*Directories*/ false);
+
+		uint64 NumRead = 0;
+		for (const FString& File : Files)
+		{
+			TArray<FGasXJournalEntry> Entries;
+			if (!TestTrue(FString::Printf(TEXT("%s reads back"), *File), FGasXAttributeJournal::ReadFile(SessionDirectory / File, Entries)))
+			{
+				continue;
+			}
+
+			NumRead += Entries.Num();
+			for (const FGasXJournalEntry& Entry : Entries)
+			{
+				const bool bConsistent = Entry.WhoId == static_cast<uint32>(Entry.Frame)
+					&& Entry.OldValue == static_cast<float>(Entry.Frame % 1000)
+					&& Entry.NewValue == Entry.OldValue + 1.0f
+					&& Entry.Who == FName(TEXT("GasXJournalRestartActor"));
+				NumTorn += bConsistent ? 0 : 1;
+			}
+		}
+
+		TestEqual(FString::Printf(TEXT("Session %d wrote every counted entry"), Session), NumRead, NumWrittenPerSession[Session]);
+	}
+
+	TestEqual(TEXT("No torn entries"), NumTorn, 0);
+	IFileManager::Get().DeleteDirectory(*Directory, /*RequireExists*/ false, /*Tree*/ true);
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "GasXAttributeTelemetrySubsystem.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXAttributeTelemetryDistributionTest,
+	"GasX.Runtime.Telemetry.Distribution",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXAttributeTelemetryDistributionTest::RunTest(const FString& Parameters)
+{
+	// WHY: Chunked parallel passes must agree with the obvious serial answer, including across chunk boundaries
+	TArray<float> Values;
+	for (int32 Value = 10000; Value >= 1; --Value)
+	{
+		Values.Add(static_cast<float>(Value));
+	}
+
+	const FGasXAttributeDistribution Distribution = UGasXAttributeTelemetrySubsystem::ComputeDistribution(TEXT("Health"), Values, /*bRatio*/ false, 0.2f, 10);
+	TestEqual(TEXT("Count"), Distribution.Count, 10000);
+	TestEqual(TEXT("Min"), Distribution.Min, 1.0f);
+	TestEqual(TEXT("Max"), Distribution.Max, 10000.0f);
+	TestEqual(TEXT("Mean"), Distribution.Mean, 5000.5f);
+	TestEqual(TEXT("P50"), Distribution.P50, 5000.0f);
+	TestEqual(TEXT("P90"), Distribution.P90, 9000.0f);
+	TestEqual(TEXT("P99"), Distribution.P99, 9900.0f);
+	TestEqual(TEXT("Below 20% of max"), Distribution.NumLow, 1999);
+
+	int32 Total = 0;
+	for (const int32 Bucket : Distribution.Buckets)
+	{
+		Total += Bucket;
+	}
+	TestEqual(TEXT("Buckets cover every sample"), Total, 10000);
+	TestEqual(TEXT("Top bucket holds the max"), Distribution.Buckets.Last(), 1000);
+
+	TArray<float> Ratios = {0.1f, 0.15f, 0.5f, 1.0f};
+	const FGasXAttributeDistribution RatioDistribution = UGasXAttributeTelemetrySubsystem::ComputeDistribution(TEXT("Health/MaxHealth"), Ratios, /*bRatio*/ true, 0.2f, 4);
+	TestEqual(TEXT("Ratios below 20%"), RatioDistribution.NumLow, 2);
+
+	TArray<float> Empty;
+	TestEqual(TEXT("Empty input"), UGasXAttributeTelemetrySubsystem::ComputeDistribution(TEXT("Mana"), Empty, false, 0.2f, 4).Count, 0);
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "GasXBakedAttributeDefaults.h"
+#include "GasXAttributeMetadata.h"
+#include "Engine/DataTable.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/ObjectWriter.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXBakedAttributeDefaultsTest,
+	"GasX.Runtime.BakedDefaults.BakeAndFind",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXBakedAttributeDefaultsTest::RunTest(const FString& Parameters)
+{
+	UDataTable* Table = NewObject<UDataTable>(GetTransientPackage(), TEXT("GasXBakeTestMetadata"), RF_Transient);
+	Table->RowStruct = FGasXAttributeMetadataRow::StaticStruct();
+
+	FGasXAttributeMetadataRow Health;
+	Health.BaseValue = 120.0;
+	Health.MinValue = 0.0;
+	Health.MaxValue = 200.0;
+	Health.Description = TEXT("Stripped on cook");
+	Table->AddRow(TEXT("Health"), Health);
+
+	FGasXAttributeMetadataRow Mana;
+	Mana.BaseValue = 40.0;
+	Table->AddRow(TEXT("Mana"), Mana);
+
+	UGasXBakedAttributeDefaults* Baked = NewObject<UGasXBakedAttributeDefaults>(GetTransientPackage(), NAME_None, RF_Transient);
+	const TArray<const UDataTable*> Tables = {Table};
+	Baked->Bake(Tables);
+
+	TestEqual(TEXT("Every row baked"), Baked->GetNumRows(), 2);
+	TestEqual(TEXT("Payload holds one POD value per row"), Baked->GetValues().Num(), 2);
+
+	const FGasXBakedAttributeDefault* BakedHealth = Baked->Find(TEXT("GasXBakeTestMetadata"), TEXT("Health"));
+	if (TestNotNull(TEXT("Health baked"), BakedHealth))
+	{
+		TestEqual(TEXT("Base value"), BakedHealth->BaseValue, 120.0f);
+		TestEqual(TEXT("Max value"), BakedHealth->MaxValue, 200.0f);
+	}
+
+	TestNull(TEXT("Unknown table is not found"), Baked->Find(TEXT("OtherMetadata"), TEXT("Health")));
+	TestNull(TEXT("Unknown row is not found"), Baked->Find(TEXT("GasXBakeTestMetadata"), TEXT("Stamina")));
+
+	// WHY: Rebaking must release the read lock taken by the previous lookup
+	Table->RemoveRow(TEXT("Mana"));
+	Baked->Bake(Tables);
+	TestEqual(TEXT("Rebake reflects removed rows"), Baked->GetValues().Num(), 1);
+
+	// WHY: An editor save after a runtime lookup must not serialize the bulk data while it is still locked
+	TArray<uint8> SavedBytes;
+	FObjectWriter Writer(Baked, SavedBytes);
+	TestTrue(TEXT("Saved after a lookup"), SavedBytes.Num() > 0);
+	TestNotNull(TEXT("Lookups resolve again after a save"), Baked->Find(TEXT("GasXBakeTestMetadata"), TEXT("Health")));
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS && WITH_EDITOR
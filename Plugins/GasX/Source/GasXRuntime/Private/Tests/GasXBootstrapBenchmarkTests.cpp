@@ -0,0 +1,258 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "GasXAttributeBootstrapComponent.h"
+#include "GasXAttributeMetadata.h"
+#include "AbilitySystemComponent.h"
+#include "Attributes/PlayerCoreAttributes.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectArray.h"
+
+/**
+ * Bootstrap throughput benchmarks.
+ *
+ * Spawns N actors with an ASC and a bootstrap component in a transient game world for each init path and
+ * records per-actor time, peak memory growth, UObject growth and the cost of the garbage collection that
+ * tears the actors down. Results are appended to Saved/GasX/Benchmarks/BootstrapThroughput.csv.
+ *
+ * Headless run:
+ *   UnrealEditor-Cmd GasXtension.uproject -ExecCmds="Automation RunTests GasX.Runtime.Benchmark.Bootstrap; Quit" -nullrhi -unattended
+ *
+ * Regression thresholds are console variables (0 disables a check); set them with -ExecCmds, -dpcvars or
+ * [SystemSettings] in DefaultEngine.ini.
+ */
+namespace GasXBootstrapBenchmark
+{
+	static TAutoConsoleVariable<float> CVarMaxPerActorMicroseconds(
+		TEXT("GasX.Benchmark.Bootstrap.MaxPerActorMicroseconds"), 0.0f,
+		TEXT("Fail bootstrap benchmarks whose spawn + bootstrap time per actor exceeds this (0 = no limit)"));
+
+	static TAutoConsoleVariable<float> CVarMaxPerActorUObjects(
+		TEXT("GasX.Benchmark.Bootstrap.MaxPerActorUObjects"), 0.0f,
+		TEXT("Fail bootstrap benchmarks that create more UObjects per actor than this (0 = no limit)"));
+
+	static TAutoConsoleVariable<float> CVarMaxPeakMemoryMB(
+		TEXT("GasX.Benchmark.Bootstrap.MaxPeakMemoryMB"), 0.0f,
+		TEXT("Fail bootstrap benchmarks whose peak physical memory growth exceeds this (0 = no limit)"));
+
+	static TAutoConsoleVariable<float> CVarMaxGCMilliseconds(
+		TEXT("GasX.Benchmark.Bootstrap.MaxGCMilliseconds"), 0.0f,
+		TEXT("Fail bootstrap benchmarks whose teardown garbage collection exceeds this (0 = no limit)"));
+
+	enum class EInitPath : uint8
+	{
+		None,
+		DataTable,
+		InitGE,
+		UniversalGE
+	};
+
+	static const TCHAR* LexToString(EInitPath Path)
+	{
+		switch (Path)
+		{
+		case EInitPath::DataTable:   return TEXT("DataTable");
+		case EInitPath::InitGE:      return TEXT("InitGE");
+		case EInitPath::UniversalGE: return TEXT("UniversalGE");
+		default:                     return TEXT("None");
+		}
+	}
+
+	struct FResult
+	{
+		int32 NumActors = 0;
+		EInitPath Path = EInitPath::None;
+		double SpawnMs = 0.0;
+		double BootstrapMs = 0.0;
+		double PerActorMicroseconds = 0.0;
+		double PeakMemoryMB = 0.0;
+		int32 UObjectDelta = 0;
+		double GCMs = 0.0;
+	};
+
+	static UDataTable* MakeMetadataTable()
+	{
+		UDataTable* Table = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+		Table->RowStruct = FGasXAttributeMetadataRow::StaticStruct();
+
+		for (const TCHAR* AttributeName : {TEXT("Health"), TEXT("MaxHealth"), TEXT("Mana"), TEXT("Stamina"), TEXT("Energy")})
+		{
+			FGasXAttributeMetadataRow Row;
+			Row.BaseValue = 100.0;
+			Table->AddRow(AttributeName, Row);
+		}
+		return Table;
+	}
+
+	static void AppendCsv(const FResult& Result)
+	{
+		const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("GasX/Benchmarks/BootstrapThroughput.csv");
+
+		FString Csv;
+		if (!IFileManager::Get().FileExists(*CsvPath))
+		{
+			Csv += TEXT("Timestamp,Actors,InitPath,SpawnMs,BootstrapMs,PerActorUs,PeakMemoryMB,UObjectDelta,GCMs\n");
+		}
+
+		Csv += FString::Printf(TEXT("%s,%d,%s,%.3f,%.3f,%.3f,%.3f,%d,%.3f\n"),
+			*FDateTime::UtcNow().ToIso8601(), Result.NumActors, LexToString(Result.Path),
+			Result.SpawnMs, Result.BootstrapMs, Result.PerActorMicroseconds, Result.PeakMemoryMB, Result.UObjectDelta, Result.GCMs);
+
+		FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	}
+
+	static FResult Run(int32 NumActors, EInitPath Path)
+	{
+		FResult Result;
+		Result.NumActors = NumActors;
+		Result.Path = Path;
+
+		UDataTable* MetadataTable = Path == EInitPath::DataTable ? MakeMetadataTable() : nullptr;
+		if (MetadataTable)
+		{
+			MetadataTable->AddToRoot();
+		}
+		const TSubclassOf<UGameplayEffect> InitEffect = Path == EInitPath::InitGE ? UGE_InitPlayerCoreAttributes::StaticClass() : nullptr;
+
+		// WHY: Start from a clean heap so GC and memory numbers only reflect this run
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		FURL URL;
+		World->InitializeActorsForPlay(URL);
+		World->BeginPlay();
+
+		const uint64 BaselineMemory = FPlatformMemory::GetStats().UsedPhysical;
+		uint64 PeakMemory = BaselineMemory;
+		const int32 BaselineObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+		TArray<UGasXAttributeBootstrapComponent*> Bootstraps;
+		Bootstraps.Reserve(NumActors);
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumActors; ++Index)
+		{
+			AActor* Owner = World->SpawnActor<AActor>();
+
+			UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Owner);
+			Owner->AddInstanceComponent(ASC);
+			ASC->RegisterComponentWithWorld(World);
+
+			UGasXAttributeBootstrapComponent* Bootstrap = NewObject<UGasXAttributeBootstrapComponent>(Owner);
+			Owner->AddInstanceComponent(Bootstrap);
+			Bootstrap->RegisterComponentWithWorld(World);
+			Bootstrap->TestAddAttributeSetType(UPlayerCoreAttributes::StaticClass());
+			Bootstrap->TestSetInitSources(MetadataTable, InitEffect);
+			Bootstrap->TestSetUseUniversalInitEffect(Path == EInitPath::UniversalGE);
+			Bootstraps.Add(Bootstrap);
+		}
+		Result.SpawnMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < Bootstraps.Num(); ++Index)
+		{
+			Bootstraps[Index]->RunBootstrapForTests();
+
+			// NOTE: Sample sparsely so the memory query does not dominate the measurement
+			if ((Index & 127) == 0)
+			{
+				PeakMemory = FMath::Max(PeakMemory, FPlatformMemory::GetStats().UsedPhysical);
+			}
+		}
+		Result.BootstrapMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		PeakMemory = FMath::Max(PeakMemory, FPlatformMemory::GetStats().UsedPhysical);
+		Result.PeakMemoryMB = static_cast<double>(PeakMemory - BaselineMemory) / (1024.0 * 1024.0);
+		Result.UObjectDelta = GUObjectArray.GetObjectArrayNumMinusAvailable() - BaselineObjects;
+		Result.PerActorMicroseconds = NumActors > 0 ? (Result.SpawnMs + Result.BootstrapMs) * 1000.0 / NumActors : 0.0;
+
+		World->EndPlay(EEndPlayReason::Quit);
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+
+		if (MetadataTable)
+		{
+			MetadataTable->RemoveFromRoot();
+		}
+
+		StartTime = FPlatformTime::Seconds();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		Result.GCMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		return Result;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FGasXBootstrapThroughputBenchmark,
+	"GasX.Runtime.Benchmark.BootstrapThroughput",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FGasXBootstrapThroughputBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	using namespace GasXBootstrapBenchmark;
+
+	for (const int32 NumActors : {100, 1000, 10000})
+	{
+		for (const EInitPath Path : {EInitPath::None, EInitPath::DataTable, EInitPath::InitGE, EInitPath::UniversalGE})
+		{
+			OutBeautifiedNames.Add(FString::Printf(TEXT("%d Actors %s"), NumActors, LexToString(Path)));
+			OutTestCommands.Add(FString::Printf(TEXT("%d %d"), NumActors, static_cast<int32>(Path)));
+		}
+	}
+}
+
+bool FGasXBootstrapThroughputBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace GasXBootstrapBenchmark;
+
+	FString CountString, PathString;
+	if (!Parameters.Split(TEXT(" "), &CountString, &PathString))
+	{
+		AddError(FString::Printf(TEXT("Malformed benchmark parameters: %s"), *Parameters));
+		return false;
+	}
+
+	const int32 NumActors = FCString::Atoi(*CountString);
+	const EInitPath Path = static_cast<EInitPath>(FCString::Atoi(*PathString));
+
+	const FResult Result = Run(NumActors, Path);
+	AppendCsv(Result);
+
+	AddInfo(FString::Printf(TEXT("%d actors, %s: spawn %.2f ms, bootstrap %.2f ms, %.2f us/actor, peak +%.2f MB, +%d UObjects, GC %.2f ms"),
+		Result.NumActors, LexToString(Result.Path), Result.SpawnMs, Result.BootstrapMs, Result.PerActorMicroseconds,
+		Result.PeakMemoryMB, Result.UObjectDelta, Result.GCMs));
+
+	auto CheckThreshold = [this](const TCHAR* Metric, double Value, float Limit)
+	{
+		if (Limit > 0.0f && Value > Limit)
+		{
+			AddError(FString::Printf(TEXT("Regression: %s %.3f exceeds threshold %.3f"), Metric, Value, Limit));
+		}
+	};
+
+	CheckThreshold(TEXT("per-actor time (us)"), Result.PerActorMicroseconds, CVarMaxPerActorMicroseconds.GetValueOnGameThread());
+	CheckThreshold(TEXT("UObjects per actor"), NumActors > 0 ? static_cast<double>(Result.UObjectDelta) / NumActors : 0.0, CVarMaxPerActorUObjects.GetValueOnGameThread());
+	CheckThreshold(TEXT("peak memory (MB)"), Result.PeakMemoryMB, CVarMaxPeakMemoryMB.GetValueOnGameThread());
+	CheckThreshold(TEXT("teardown GC (ms)"), Result.GCMs, CVarMaxGCMilliseconds.GetValueOnGameThread());
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -3,12 +3,15 @@
 #if WITH_AUTOMATION_TESTS
 
 #include "GasXAttributeBootstrapComponent.h"
+#include "GasXAsyncWaitAttributesReady.h"
 #include "AbilitySystemComponent.h"
 #include "Attributes/PlayerCoreAttributes.h"
+#include "Attributes/PrimaryAttributes.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Misc/AutomationTest.h"
+#include "Tests/GasXTestActors.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FGasXBootstrapIdempotencyTest,
@@ -186,4 +189,278 @@ bool FGasXBootstrapAuthorityTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXBootstrapResetOnRespawnTest,
+	"GasX.Runtime.Bootstrap.ResetsExistingSetsOnRespawn",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXBootstrapResetOnRespawnTest::RunTest(const FString& Parameters)
+{
+	// WHY: A set that survives a respawn must start the new life at its compiled defaults, not its last values
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	AActor* Owner = World->SpawnActor<AActor>();
+	UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Owner);
+	Owner->AddInstanceComponent(ASC);
+	ASC->RegisterComponentWithWorld(World);
+
+	UGasXAttributeBootstrapComponent* Bootstrap = NewObject<UGasXAttributeBootstrapComponent>(Owner);
+	Owner->AddInstanceComponent(Bootstrap);
+	Bootstrap->RegisterComponentWithWorld(World);
+	Bootstrap->TestAddAttributeSetType(UPlayerCoreAttributes::StaticClass());
+
+	Bootstrap->RunBootstrapForTests();
+	const UPlayerCoreAttributes* FirstLife = ASC->GetSet<UPlayerCoreAttributes>();
+	if (TestNotNull(TEXT("Set added on first bootstrap"), FirstLife))
+	{
+		// Simulate the end of a life: damaged and stunned
+		UPlayerCoreAttributes* MutableSet = const_cast<UPlayerCoreAttributes*>(FirstLife);
+		MutableSet->InitHealth(12.0f);
+		MutableSet->SetStunned(true);
+
+		Bootstrap->RunBootstrapForTests();
+		const UPlayerCoreAttributes* SecondLife = ASC->GetSet<UPlayerCoreAttributes>();
+		TestTrue(TEXT("Respawn reuses the existing set"), SecondLife == FirstLife);
+		TestEqual(TEXT("Health back at its default"), SecondLife->GetHealth(), 100.0f);
+		TestFalse(TEXT("Flags back at their defaults"), SecondLife->IsStunned());
+	}
+
+	Bootstrap->DestroyComponent();
+	ASC->DestroyComponent();
+	Owner->Destroy();
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXBootstrapResetWithActiveModifierTest,
+	"GasX.Runtime.Bootstrap.ResetKeepsActiveModifiersInSync",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXBootstrapResetWithActiveModifierTest::RunTest(const FString& Parameters)
+{
+	// WHY: A reset that bypasses the ASC leaves the aggregator's old base behind, which returns once the modifier goes
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	AActor* Owner = World->SpawnActor<AActor>();
+	UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Owner);
+	Owner->AddInstanceComponent(ASC);
+	ASC->RegisterComponentWithWorld(World);
+
+	UGasXAttributeBootstrapComponent* Bootstrap = NewObject<UGasXAttributeBootstrapComponent>(Owner);
+	Owner->AddInstanceComponent(Bootstrap);
+	Bootstrap->RegisterComponentWithWorld(World);
+	Bootstrap->TestAddAttributeSetType(UPlayerCoreAttributes::StaticClass());
+	Bootstrap->RunBootstrapForTests();
+
+	const FGameplayAttribute MaxHealth = UPlayerCoreAttributes::GetMaxHealthAttribute();
+
+	UGameplayEffect* Buff = NewObject<UGameplayEffect>(GetTransientPackage(), NAME_None, RF_Transient);
+	Buff->DurationPolicy = EGameplayEffectDurationType::HasDuration;
+	Buff->DurationMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(60.0f));
+	FGameplayModifierInfo& Modifier = Buff->Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = MaxHealth;
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(20.0f));
+	const FActiveGameplayEffectHandle BuffHandle = ASC->ApplyGameplayEffectToSelf(Buff, 1.0f, ASC->MakeEffectContext());
+
+	// Simulate the end of a life: the base was lowered while the buff is active
+	ASC->SetNumericAttributeBase(MaxHealth, 70.0f);
+	TestEqual(TEXT("Lowered base plus buff"), ASC->GetNumericAttribute(MaxHealth), 90.0f);
+
+	Bootstrap->RunBootstrapForTests();
+	TestEqual(TEXT("Reset restores the base through the ASC"), ASC->GetNumericAttributeBase(MaxHealth), 100.0f);
+	TestEqual(TEXT("Active buff still applies on top of the reset base"), ASC->GetNumericAttribute(MaxHealth), 120.0f);
+
+	ASC->RemoveActiveGameplayEffect(BuffHandle);
+	TestEqual(TEXT("Base stays at the default once the buff is removed"), ASC->GetNumericAttributeBase(MaxHealth), 100.0f);
+	TestEqual(TEXT("Current value falls back to the default, not the stale base"), ASC->GetNumericAttribute(MaxHealth), 100.0f);
+
+	Bootstrap->DestroyComponent();
+	ASC->DestroyComponent();
+	Owner->Destroy();
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXBootstrapLazySetTest,
+	"GasX.Runtime.Bootstrap.CreatesLazySetsOnFirstUse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXBootstrapLazySetTest::RunTest(const FString& Parameters)
+{
+	// WHY: A lazy set must not exist until an effect targets it, and must exist before that effect's modifiers land
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	AActor* Owner = World->SpawnActor<AActor>();
+	UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Owner);
+	Owner->AddInstanceComponent(ASC);
+	ASC->RegisterComponentWithWorld(World);
+
+	UGasXAttributeBootstrapComponent* Bootstrap = NewObject<UGasXAttributeBootstrapComponent>(Owner);
+	Owner->AddInstanceComponent(Bootstrap);
+	Bootstrap->RegisterComponentWithWorld(World);
+	Bootstrap->TestAddAttributeSetType(UPlayerCoreAttributes::StaticClass());
+	Bootstrap->TestAddLazyAttributeSetType(UPrimaryAttributes::StaticClass());
+	Bootstrap->RunBootstrapForTests();
+
+	TestNotNull(TEXT("Eager set created at bootstrap"), ASC->GetSet<UPlayerCoreAttributes>());
+	TestNull(TEXT("Lazy set not created at bootstrap"), ASC->GetSet<UPrimaryAttributes>());
+
+	UGameplayEffect* DrainMana = NewObject<UGameplayEffect>(GetTransientPackage(), NAME_None, RF_Transient);
+	FGameplayModifierInfo& Modifier = DrainMana->Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = UPrimaryAttributes::GetManaAttribute();
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(-10.0f));
+	ASC->ApplyGameplayEffectToSelf(DrainMana, 1.0f, ASC->MakeEffectContext());
+
+	const UPrimaryAttributes* Primary = ASC->GetSet<UPrimaryAttributes>();
+	if (TestNotNull(TEXT("Effect targeting the lazy set created it"), Primary))
+	{
+		TestEqual(TEXT("Effect applied on top of the defaults"), Primary->GetMana(), 40.0f);
+		TestTrue(TEXT("Accessor returns the same instance"), Bootstrap->GetOrCreateAttributeSet<UPrimaryAttributes>() == Primary);
+	}
+
+	Bootstrap->DestroyComponent();
+	ASC->DestroyComponent();
+	Owner->Destroy();
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXBootstrapAttributesReadyTest,
+	"GasX.Runtime.Bootstrap.ReportsAttributesReadyOnce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXBootstrapAttributesReadyTest::RunTest(const FString& Parameters)
+{
+	// WHY: The server is ready as soon as bootstrap finishes, and a respawn re-bootstrap must not report it again
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	AActor* Owner = World->SpawnActor<AActor>();
+	UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Owner);
+	Owner->AddInstanceComponent(ASC);
+	ASC->RegisterComponentWithWorld(World);
+
+	UGasXAttributeBootstrapComponent* Bootstrap = NewObject<UGasXAttributeBootstrapComponent>(Owner);
+	Owner->AddInstanceComponent(Bootstrap);
+	Bootstrap->RegisterComponentWithWorld(World);
+	Bootstrap->TestAddAttributeSetType(UPlayerCoreAttributes::StaticClass());
+
+	TestFalse(TEXT("Not ready before bootstrap"), Bootstrap->AreAttributesReady());
+	Bootstrap->RunBootstrapForTests();
+	TestTrue(TEXT("Ready after server bootstrap"), Bootstrap->AreAttributesReady());
+
+	Bootstrap->RunBootstrapForTests();
+	TestTrue(TEXT("Still ready after re-bootstrap"), Bootstrap->AreAttributesReady());
+
+	Bootstrap->DestroyComponent();
+	ASC->DestroyComponent();
+	Owner->Destroy();
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXAsyncWaitAttributesReadyImmediateTest,
+	"GasX.Runtime.Bootstrap.AsyncWaitCompletesWhenAlreadyReady",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXAsyncWaitAttributesReadyImmediateTest::RunTest(const FString& Parameters)
+{
+	// WHY: Nodes started after the one-shot broadcast would otherwise wait forever
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	AGasXTestBootstrapActor* Owner = World->SpawnActor<AGasXTestBootstrapActor>();
+	TestTrue(TEXT("Ready after server BeginPlay"), Owner->GetBootstrap()->AreAttributesReady());
+	TestEqual(TEXT("Ready broadcast once during BeginPlay"), Owner->NumReadyBroadcasts, 1);
+
+	UGasXAsyncWaitAttributesReady* Action = UGasXAsyncWaitAttributesReady::WaitForAttributesReady(Owner);
+	Action->OnReady.AddDynamic(Owner, &AGasXTestBootstrapActor::HandleAttributesReady);
+	Action->Activate();
+	TestEqual(TEXT("OnReady fires during Activate when already ready"), Owner->NumReadyBroadcasts, 2);
+	TestTrue(TEXT("Sets are present when OnReady fires"), Owner->HealthAtReady.IsSet());
+
+	Owner->Destroy();
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
 #endif // WITH_AUTOMATION_TESTS
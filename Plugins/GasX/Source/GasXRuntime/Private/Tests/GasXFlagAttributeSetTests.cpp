@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "Attributes/PlayerCoreAttributes.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXFlagAttributeSetPackedBitsTest,
+	"GasX.Runtime.Flags.PackedBits",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXFlagAttributeSetPackedBitsTest::RunTest(const FString& Parameters)
+{
+	UPlayerCoreAttributes* Set = NewObject<UPlayerCoreAttributes>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	TestEqual(TEXT("Flags start at the schema defaults"), Set->GetFlagBits(), static_cast<uint64>(0));
+	TestEqual(TEXT("Flag names follow bit order"), Set->GetFlagNames().Num(), 3);
+	TestEqual(TEXT("Named flag resolves to its mask"), Set->FindFlagMask(TEXT("InCombat")), UPlayerCoreAttributes::InCombatFlag);
+	TestEqual(TEXT("Unknown flag has no mask"), Set->FindFlagMask(TEXT("Burning")), static_cast<uint64>(0));
+
+	uint64 LastChangedMask = 0;
+	int32 NumNotifications = 0;
+	Set->OnFlagsChanged.AddLambda([&](uint64 ChangedMask, uint64 NewFlagBits)
+	{
+		LastChangedMask = ChangedMask;
+		++NumNotifications;
+	});
+
+	Set->SetStunned(true);
+	TestTrue(TEXT("Stunned set"), Set->IsStunned());
+	TestFalse(TEXT("Other flags untouched"), Set->IsInCombat());
+	TestEqual(TEXT("Change mask names the changed bit"), LastChangedMask, UPlayerCoreAttributes::StunnedFlag);
+
+	Set->SetStunned(true);
+	TestEqual(TEXT("Setting a set flag does not notify"), NumNotifications, 1);
+
+	// WHY: Overlapping duration effects must keep the flag until the last one ends
+	Set->AddFlagGrant(UPlayerCoreAttributes::InvulnerableFlag);
+	Set->AddFlagGrant(UPlayerCoreAttributes::InvulnerableFlag);
+	Set->RemoveFlagGrant(UPlayerCoreAttributes::InvulnerableFlag);
+	TestTrue(TEXT("Flag held while a grant remains"), Set->IsInvulnerable());
+	Set->RemoveFlagGrant(UPlayerCoreAttributes::InvulnerableFlag);
+	TestFalse(TEXT("Flag cleared with the last grant"), Set->IsInvulnerable());
+
+	// WHY: A grant ending must not clear a flag an instant effect set on its own
+	Set->SetInCombat(true);
+	Set->AddFlagGrant(UPlayerCoreAttributes::InCombatFlag);
+	Set->RemoveFlagGrant(UPlayerCoreAttributes::InCombatFlag);
+	TestTrue(TEXT("Instantly set flag survives an unrelated grant ending"), Set->IsInCombat());
+	Set->SetInCombat(false);
+
+	TestTrue(TEXT("Mask test"), Set->TestFlagBits(UPlayerCoreAttributes::StunnedFlag));
+	TestFalse(TEXT("All-bits test fails on a partial match"), Set->TestFlagBits(UPlayerCoreAttributes::StunnedFlag | UPlayerCoreAttributes::InCombatFlag));
+	TestTrue(TEXT("Any-bits test passes on a partial match"), Set->TestAnyFlagBits(UPlayerCoreAttributes::StunnedFlag | UPlayerCoreAttributes::InCombatFlag));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXFlagAttributeSetGrantOverDefaultTest,
+	"GasX.Runtime.Flags.GrantKeepsDefault",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXFlagAttributeSetGrantOverDefaultTest::RunTest(const FString& Parameters)
+{
+	UPlayerCoreAttributes* Set = NewObject<UPlayerCoreAttributes>(GetTransientPackage(), NAME_None, RF_Transient);
+	Set->TestInitFlagBits(UPlayerCoreAttributes::InvulnerableFlag);
+	TestTrue(TEXT("Default-true flag starts set"), Set->IsInvulnerable());
+
+	Set->AddFlagGrant(UPlayerCoreAttributes::InvulnerableFlag);
+	Set->RemoveFlagGrant(UPlayerCoreAttributes::InvulnerableFlag);
+	TestTrue(TEXT("Default-true flag is still set after its grant ends"), Set->IsInvulnerable());
+
+	// WHY: Clearing the base while granted takes effect once the grant ends
+	Set->AddFlagGrant(UPlayerCoreAttributes::InvulnerableFlag);
+	Set->SetInvulnerable(false);
+	TestTrue(TEXT("Grant holds the flag"), Set->IsInvulnerable());
+	Set->RemoveFlagGrant(UPlayerCoreAttributes::InvulnerableFlag);
+	TestFalse(TEXT("Cleared base shows once the grant ends"), Set->IsInvulnerable());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXFlagAttributeSetResetKeepsGrantsTest,
+	"GasX.Runtime.Flags.ResetKeepsActiveGrants",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXFlagAttributeSetResetKeepsGrantsTest::RunTest(const FString& Parameters)
+{
+	// WHY: Effects active across a respawn reset still remove their grants later; the counts must still match them
+	UPlayerCoreAttributes* Set = NewObject<UPlayerCoreAttributes>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	Set->AddFlagGrant(UPlayerCoreAttributes::StunnedFlag);
+	Set->SetInCombat(true);
+	Set->ResetToDefaults();
+	TestTrue(TEXT("Reset keeps a bit held by an active grant"), Set->IsStunned());
+	TestFalse(TEXT("Reset restores the base bits"), Set->IsInCombat());
+
+	// A grant made after the reset must survive the earlier effect's removal
+	Set->AddFlagGrant(UPlayerCoreAttributes::StunnedFlag);
+	Set->RemoveFlagGrant(UPlayerCoreAttributes::StunnedFlag);
+	TestTrue(TEXT("Later grant still holds the bit"), Set->IsStunned());
+
+	Set->RemoveFlagGrant(UPlayerCoreAttributes::StunnedFlag);
+	TestFalse(TEXT("Bit clears once the last grant ends"), Set->IsStunned());
+
+	Set->RemoveFlagGrant(UPlayerCoreAttributes::StunnedFlag);
+	Set->AddFlagGrant(UPlayerCoreAttributes::StunnedFlag);
+	TestTrue(TEXT("Counts did not underflow"), Set->IsStunned());
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "Attributes/PlayerCoreAttributes.h"
+#include "Attributes/PrimaryAttributes.h"
+#include "GameplayEffect.h"
+#include "GasXUniversalInitEffect.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXInitGameplayEffectModifiersBoundTest,
+	"GasX.Runtime.InitGameplayEffect.ModifiersBound",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXInitGameplayEffectModifiersBoundTest::RunTest(const FString& Parameters)
+{
+	// WHY: The generated native init effect must be usable straight from its CDO, with every modifier bound
+	const UGameplayEffect* Effect = GetDefault<UGE_InitPlayerCoreAttributes>();
+	if (!TestNotNull(TEXT("Init effect CDO"), Effect))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Init effect is instant"), Effect->DurationPolicy, EGameplayEffectDurationType::Instant);
+	TestEqual(TEXT("One modifier per attribute"), Effect->Modifiers.Num(), 5);
+
+	for (const FGameplayModifierInfo& Modifier : Effect->Modifiers)
+	{
+		TestTrue(TEXT("Modifier attribute is bound"), Modifier.Attribute.IsValid());
+		TestTrue(TEXT("Modifier targets UPlayerCoreAttributes"), Modifier.Attribute.GetAttributeSetClass() == UPlayerCoreAttributes::StaticClass());
+		TestEqual(TEXT("Modifier overrides the base value"), Modifier.ModifierOp, EGameplayModOp::Override);
+	}
+
+	float HealthMagnitude = 0.0f;
+	const FGameplayModifierInfo* HealthModifier = Effect->Modifiers.FindByPredicate([](const FGameplayModifierInfo& Modifier)
+	{
+		return Modifier.Attribute == UPlayerCoreAttributes::GetHealthAttribute();
+	});
+	if (TestNotNull(TEXT("Health modifier"), HealthModifier))
+	{
+		TestTrue(TEXT("Health magnitude is static"), HealthModifier->ModifierMagnitude.GetStaticMagnitudeIfPossible(1.0f, HealthMagnitude));
+		TestEqual(TEXT("Health magnitude matches schema default"), HealthMagnitude, 100.0f);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXUniversalInitEffectCoversAllSetsTest,
+	"GasX.Runtime.InitGameplayEffect.UniversalCoversAllSets",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXUniversalInitEffectCoversAllSetsTest::RunTest(const FString& Parameters)
+{
+	const TArray<const UClass*> SetClasses = {UPlayerCoreAttributes::StaticClass(), UPrimaryAttributes::StaticClass()};
+	UGasXUniversalInitEffect* Effect = UGasXUniversalInitEffect::GetForSets(SetClasses);
+	if (!TestNotNull(TEXT("Universal init effect for generated sets"), Effect))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("One SetByCaller modifier per attribute across both sets"), Effect->Modifiers.Num(), 8);
+
+	const TArray<const UClass*> ReversedClasses = {UPrimaryAttributes::StaticClass(), UPlayerCoreAttributes::StaticClass()};
+	TestTrue(TEXT("Same set combination shares one effect"), UGasXUniversalInitEffect::GetForSets(ReversedClasses) == Effect);
+
+	// WHY: A single spec must carry a magnitude for every modifier, falling back to schema defaults without a table
+	FGameplayEffectSpec Spec(Effect, FGameplayEffectContextHandle(), 1.0f);
+	Effect->FillSpec(Spec, FGasXInitValueSources());
+	for (const FGasXInitAttribute& InitAttribute : Effect->GetInitAttributes())
+	{
+		TestTrue(TEXT("SetByCaller tag is valid"), InitAttribute.SetByCallerTag.IsValid());
+		TestEqual(TEXT("SetByCaller magnitude uses schema default"), Spec.GetSetByCallerMagnitude(InitAttribute.SetByCallerTag, /*WarnIfNotFound*/ false, -1.0f), InitAttribute.DefaultValue);
+	}
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "GasXLevelCurveSamples.h"
+#include "Engine/CurveTable.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXLevelCurveSamplesTest,
+	"GasX.Runtime.LevelCurves.SamplesPerLevel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXLevelCurveSamplesTest::RunTest(const FString& Parameters)
+{
+	UCurveTable* Table = NewObject<UCurveTable>(GetTransientPackage(), NAME_None, RF_Transient);
+	FRichCurve& Health = Table->AddRichCurve(TEXT("Health"));
+	Health.SetKeyInterpMode(Health.AddKey(1.0f, 100.0f), RCIM_Linear);
+	Health.SetKeyInterpMode(Health.AddKey(11.0f, 200.0f), RCIM_Linear);
+
+	TSharedPtr<const FGasXLevelCurveSamples> Samples = FGasXLevelCurveSamples::Get(Table);
+	if (!TestTrue(TEXT("Samples built"), Samples.IsValid()))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Max level covers the last key"), Samples->GetMaxLevel(), 11);
+
+	float Value = 0.0f;
+	TestTrue(TEXT("Health row sampled"), Samples->TryGetValue(TEXT("Health"), 6, Value));
+	TestEqual(TEXT("Level 6 interpolates linearly"), Value, 150.0f);
+
+	TestTrue(TEXT("Levels past the curve clamp"), Samples->TryGetValue(TEXT("Health"), 37, Value));
+	TestEqual(TEXT("Clamped to last key"), Value, 200.0f);
+
+	TestFalse(TEXT("Unknown row is not found"), Samples->TryGetValue(TEXT("Mana"), 1, Value));
+
+	TestTrue(TEXT("Samples are shared per table"), FGasXLevelCurveSamples::Get(Table) == Samples);
+
+	// WHY: Editing the table must invalidate the cached samples
+	Table->OnCurveTableChanged().Broadcast();
+	TestTrue(TEXT("Samples rebuilt after change"), FGasXLevelCurveSamples::Get(Table) != Samples);
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc.
+
+#if WITH_AUTOMATION_TESTS
+
+#include "GasXLiveTuningSubsystem.h"
+#include "GasXAttributeBootstrapComponent.h"
+#include "GasXAttributeMetadata.h"
+#include "AbilitySystemComponent.h"
+#include "Attributes/PlayerCoreAttributes.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FGasXLiveTuningRolloutTest,
+	"GasX.Runtime.LiveTuning.AppliesChangedRows",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGasXLiveTuningRolloutTest::RunTest(const FString& Parameters)
+{
+	// WHY: A metadata table edit must reach live actors, and only the rows that changed may be touched
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Created transient world"), World))
+	{
+		return false;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	UDataTable* Table = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+	Table->RowStruct = FGasXAttributeMetadataRow::StaticStruct();
+	FGasXAttributeMetadataRow HealthRow;
+	HealthRow.BaseValue = 150.0;
+	Table->AddRow(TEXT("Health"), HealthRow);
+	FGasXAttributeMetadataRow ManaRow;
+	ManaRow.BaseValue = 40.0;
+	Table->AddRow(TEXT("Mana"), ManaRow);
+
+	AActor* Owner = World->SpawnActor<AActor>();
+	UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Owner);
+	Owner->AddInstanceComponent(ASC);
+	ASC->RegisterComponentWithWorld(World);
+
+	UGasXAttributeBootstrapComponent* Bootstrap = NewObject<UGasXAttributeBootstrapComponent>(Owner);
+	Owner->AddInstanceComponent(Bootstrap);
+	Bootstrap->RegisterComponentWithWorld(World);
+	Bootstrap->TestAddAttributeSetType(UPlayerCoreAttributes::StaticClass());
+	Bootstrap->TestSetInitSources(Table, nullptr);
+	Bootstrap->TestSetUseUniversalInitEffect(true);
+	Bootstrap->RunBootstrapForTests();
+
+	UGasXLiveTuningSubsystem* LiveTuning = World->GetSubsystem<UGasXLiveTuningSubsystem>();
+	const UPlayerCoreAttributes* Set = ASC->GetSet<UPlayerCoreAttributes>();
+	if (TestNotNull(TEXT("Live tuning subsystem exists in game worlds"), LiveTuning) && TestNotNull(TEXT("Set added"), Set))
+	{
+		TestEqual(TEXT("Health initialized from the table"), Set->GetHealth(), 150.0f);
+
+		// Simulate gameplay moving Mana off its base, which an unrelated edit must not disturb
+		ASC->SetNumericAttributeBase(UPlayerCoreAttributes::GetManaAttribute(), 5.0f);
+
+		Table->FindRow<FGasXAttributeMetadataRow>(TEXT("Health"), TEXT("GasXLiveTuningTest"))->BaseValue = 80.0;
+		Table->HandleDataTableChanged();
+		TestEqual(TEXT("Change is queued, not applied inline"), LiveTuning->GetNumPendingTargets(), 1);
+
+		LiveTuning->Tick(0.0f);
+		TestEqual(TEXT("Rollout finished"), LiveTuning->GetNumPendingTargets(), 0);
+		TestEqual(TEXT("Changed row applied"), Set->GetHealth(), 80.0f);
+		TestEqual(TEXT("Unchanged row left alone"), Set->GetMana(), 5.0f);
+
+		// WHY: Retuning a default must not heal damaged actors; the damage taken carries over
+		ASC->SetNumericAttributeBase(UPlayerCoreAttributes::GetHealthAttribute(), 50.0f);
+		Table->FindRow<FGasXAttributeMetadataRow>(TEXT("Health"), TEXT("GasXLiveTuningTest"))->BaseValue = 100.0;
+		Table->HandleDataTableChanged();
+		LiveTuning->Tick(0.0f);
+		TestEqual(TEXT("Damaged actor moves by the change in default"), Set->GetHealth(), 70.0f);
+	}
+
+	Bootstrap->DestroyComponent();
+	ASC->DestroyComponent();
+	Owner->Destroy();
+
+	World->EndPlay(EEndPlayReason::Quit);
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
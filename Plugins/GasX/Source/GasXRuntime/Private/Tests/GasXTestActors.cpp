@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc.
+
+#include "Tests/GasXTestActors.h"
+#include "AbilitySystemComponent.h"
+#include "Attributes/PlayerCoreAttributes.h"
+#include "GasXAttributeBootstrapComponent.h"
+
+AGasXTestASCActor::AGasXTestASCActor()
+{
+	bReplicates = true;
+	bReplicateUsingRegisteredSubObjectList = true;
+
+	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
+	AbilitySystemComponent->SetIsReplicatedByDefault(true);
+}
+
+AGasXTestBootstrapActor::AGasXTestBootstrapActor()
+{
+	bAlwaysRelevant = true;
+
+	Bootstrap = CreateDefaultSubobject<UGasXAttributeBootstrapComponent>(TEXT("AttributeBootstrap"));
+#if WITH_AUTOMATION_TESTS
+	// NOTE: Set in the constructor so server and client instances agree on which sets to wait for
+	Bootstrap->TestAddAttributeSetType(UPlayerCoreAttributes::StaticClass());
+#endif
+}
+
+void AGasXTestBootstrapActor::BeginPlay()
+{
+	// WHY: Bind before the components begin play; the server bootstrap reports ready from inside BeginPlay
+	Bootstrap->OnAttributesReady.AddUniqueDynamic(this, &AGasXTestBootstrapActor::HandleAttributesReady);
+	Super::BeginPlay();
+}
+
+void AGasXTestBootstrapActor::HandleAttributesReady()
+{
+	++NumReadyBroadcasts;
+
+	const UPlayerCoreAttributes* Set = GetAbilitySystemComponent()->GetSet<UPlayerCoreAttributes>();
+	HealthAtReady = Set ? TOptional<float>(Set->GetHealth()) : TOptional<float>();
+}
+
+AGasXTestPlayerState::AGasXTestPlayerState()
+{
+	bReplicateUsingRegisteredSubObjectList = true;
+
+	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
+	AbilitySystemComponent->SetIsReplicatedByDefault(true);
+}
+
+AGasXTestPawn::AGasXTestPawn()
+{
+	bReplicateUsingRegisteredSubObjectList = true;
+	AutoPossessAI = EAutoPossessAI::Disabled;
+}
@@ -6,6 +6,9 @@
 #include "CoreMinimal.h"
 #include "AttributeSet.h"
 #include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GasXFlagAttributeSet.h"
+#include "GasXResettableAttributeSet.h"
 #include "PlayerCoreAttributes.generated.h"
 
 /**
@@ -13,7 +16,7 @@
  * Core player attributes: Health, Stamina, and Mana
  */
 UCLASS()
-class GASXRUNTIME_API UPlayerCoreAttributes : public UAttributeSet
+class GASXRUNTIME_API UPlayerCoreAttributes : public UGasXFlagAttributeSet, public IGasXResettableAttributeSet
 {
 	GENERATED_BODY()
 
@@ -29,14 +32,14 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category="Attributes", ReplicatedUsing=OnRep_MaxHealth)
 	FGameplayAttributeData MaxHealth;
 
-	/** Current stamina points for sprint/dodge actions */
-	UPROPERTY(BlueprintReadOnly, Category="Attributes", ReplicatedUsing=OnRep_Stamina)
-	FGameplayAttributeData Stamina;
-
 	/** Current mana for abilities */
 	UPROPERTY(BlueprintReadOnly, Category="Attributes", ReplicatedUsing=OnRep_Mana)
 	FGameplayAttributeData Mana;
 
+	/** Current stamina points for sprint/dodge actions */
+	UPROPERTY(BlueprintReadOnly, Category="Attributes", ReplicatedUsing=OnRep_Stamina)
+	FGameplayAttributeData Stamina;
+
 	/** Current energy for abilities */
 	UPROPERTY(BlueprintReadOnly, Category="Attributes", ReplicatedUsing=OnRep_Energy)
 	FGameplayAttributeData Energy;
@@ -54,16 +57,16 @@ public:
 	GAMEPLAYATTRIBUTE_VALUE_SETTER(MaxHealth)
 	GAMEPLAYATTRIBUTE_VALUE_INITTER(MaxHealth)
 
-	GAMEPLAYATTRIBUTE_PROPERTY_GETTER(UPlayerCoreAttributes, Stamina)
-	GAMEPLAYATTRIBUTE_VALUE_GETTER(Stamina)
-	GAMEPLAYATTRIBUTE_VALUE_SETTER(Stamina)
-	GAMEPLAYATTRIBUTE_VALUE_INITTER(Stamina)
-
 	GAMEPLAYATTRIBUTE_PROPERTY_GETTER(UPlayerCoreAttributes, Mana)
 	GAMEPLAYATTRIBUTE_VALUE_GETTER(Mana)
 	GAMEPLAYATTRIBUTE_VALUE_SETTER(Mana)
 	GAMEPLAYATTRIBUTE_VALUE_INITTER(Mana)
 
+	GAMEPLAYATTRIBUTE_PROPERTY_GETTER(UPlayerCoreAttributes, Stamina)
+	GAMEPLAYATTRIBUTE_VALUE_GETTER(Stamina)
+	GAMEPLAYATTRIBUTE_VALUE_SETTER(Stamina)
+	GAMEPLAYATTRIBUTE_VALUE_INITTER(Stamina)
+
 	GAMEPLAYATTRIBUTE_PROPERTY_GETTER(UPlayerCoreAttributes, Energy)
 	GAMEPLAYATTRIBUTE_VALUE_GETTER(Energy)
 	GAMEPLAYATTRIBUTE_VALUE_SETTER(Energy)
@@ -79,15 +82,53 @@ public:
 	virtual void OnRep_MaxHealth(const FGameplayAttributeData& OldValue);
 
 	UFUNCTION()
-	virtual void OnRep_Stamina(const FGameplayAttributeData& OldValue);
+	virtual void OnRep_Mana(const FGameplayAttributeData& OldValue);
 
 	UFUNCTION()
-	virtual void OnRep_Mana(const FGameplayAttributeData& OldValue);
+	virtual void OnRep_Stamina(const FGameplayAttributeData& OldValue);
 
 	UFUNCTION()
 	virtual void OnRep_Energy(const FGameplayAttributeData& OldValue);
 
 	//GEN-END: OnRep Functions
+//GEN-BEGIN: Attribute Flags
+	/** Cannot move or act */
+	static constexpr uint64 StunnedFlag = 1ull << 0;
+	bool IsStunned() const { return TestFlagBits(StunnedFlag); }
+	void SetStunned(bool bValue) { SetFlagBits(StunnedFlag, bValue); }
+
+	/** Recently dealt or took damage */
+	static constexpr uint64 InCombatFlag = 1ull << 1;
+	bool IsInCombat() const { return TestFlagBits(InCombatFlag); }
+	void SetInCombat(bool bValue) { SetFlagBits(InCombatFlag, bValue); }
+
+	/** Ignores incoming damage */
+	static constexpr uint64 InvulnerableFlag = 1ull << 2;
+	bool IsInvulnerable() const { return TestFlagBits(InvulnerableFlag); }
+	void SetInvulnerable(bool bValue) { SetFlagBits(InvulnerableFlag, bValue); }
+
+	virtual TConstArrayView<FName> GetFlagNames() const override;
+	//GEN-END: Attribute Flags
+//GEN-BEGIN: Journal Hooks
+	//GEN-END: Journal Hooks
+//GEN-BEGIN: Reset To Defaults
+	virtual void ResetToDefaults() override;
+	//GEN-END: Reset To Defaults
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty> &OutLifetimeProps) const override;
 };
+
+//GEN-BEGIN: Init GameplayEffect
+/**
+ * Generated init GameplayEffect for UPlayerCoreAttributes.
+ * Instant effect that overrides every attribute's base value with its schema default.
+ */
+UCLASS()
+class GASXRUNTIME_API UGE_InitPlayerCoreAttributes : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGE_InitPlayerCoreAttributes();
+};
+//GEN-END: Init GameplayEffect
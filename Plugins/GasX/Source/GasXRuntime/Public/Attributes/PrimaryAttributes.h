@@ -6,6 +6,8 @@
 #include "CoreMinimal.h"
 #include "AttributeSet.h"
 #include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GasXResettableAttributeSet.h"
 #include "PrimaryAttributes.generated.h"
 
 /**
@@ -13,7 +15,7 @@
  * Core player attributes: Health  and Mana
  */
 UCLASS()
-class GASXRUNTIME_API UPrimaryAttributes : public UAttributeSet
+class GASXRUNTIME_API UPrimaryAttributes : public UAttributeSet, public IGasXResettableAttributeSet
 {
 	GENERATED_BODY()
 
@@ -64,6 +66,28 @@ public:
 	virtual void OnRep_Mana(const FGameplayAttributeData& OldValue);
 
 	//GEN-END: OnRep Functions
+//GEN-BEGIN: Attribute Flags
+	//GEN-END: Attribute Flags
+//GEN-BEGIN: Journal Hooks
+	//GEN-END: Journal Hooks
+//GEN-BEGIN: Reset To Defaults
+	virtual void ResetToDefaults() override;
+	//GEN-END: Reset To Defaults
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 };
+
+//GEN-BEGIN: Init GameplayEffect
+/**
+ * Generated init GameplayEffect for UPrimaryAttributes.
+ * Instant effect that overrides every attribute's base value with its schema default.
+ */
+UCLASS()
+class GASXRUNTIME_API UGE_InitPrimaryAttributes : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGE_InitPrimaryAttributes();
+};
+//GEN-END: Init GameplayEffect
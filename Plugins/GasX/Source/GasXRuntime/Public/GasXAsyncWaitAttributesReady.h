@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "GasXAttributeBootstrapComponent.h"
+#include "GasXAsyncWaitAttributesReady.generated.h"
+
+/**
+ * Async node that completes once an actor's GasX attribute sets are ready (see UGasXAttributeBootstrapComponent::OnAttributesReady).
+ *
+ * WHY: UI and animation code can wait for replicated attributes instead of polling every tick. Completes
+ * immediately if the attributes are already ready.
+ */
+UCLASS()
+class GASXRUNTIME_API UGasXAsyncWaitAttributesReady : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Wait until Actor's bootstrap component reports its attribute sets ready.
+	 *
+	 * @param Actor Actor with a UGasXAttributeBootstrapComponent
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GasX", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf = "Actor"))
+	static UGasXAsyncWaitAttributesReady* WaitForAttributesReady(AActor* Actor);
+
+	/** Fires once, when the attributes are ready. */
+	UPROPERTY(BlueprintAssignable)
+	FGasXAttributesReadySignature OnReady;
+
+	virtual void Activate() override;
+
+private:
+	UFUNCTION()
+	void HandleAttributesReady();
+
+	TWeakObjectPtr<AActor> WeakActor;
+	TWeakObjectPtr<UGasXAttributeBootstrapComponent> WeakComponent;
+};
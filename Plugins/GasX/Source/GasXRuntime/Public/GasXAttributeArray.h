@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "GasXAttributeArray.generated.h"
+
+struct FGasXAttributeArray;
+
+/** Broadcast when an element of an attribute array changes, locally or through replication. */
+DECLARE_MULTICAST_DELEGATE_FourParams(FGasXAttributeArrayElementChanged, FName /*ArrayName*/, int32 /*Index*/, float /*OldValue*/, float /*NewValue*/);
+
+/**
+ * One written element of an indexed attribute array.
+ * Mirrors FGameplayAttributeData's base/current split.
+ */
+USTRUCT()
+struct GASXRUNTIME_API FGasXAttributeArrayElement : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+public:
+	/** Position of this element in the schema array. Replicated because fast array item order is not stable on clients. */
+	UPROPERTY()
+	uint16 Index = 0;
+
+	UPROPERTY()
+	float BaseValue = 0.0f;
+
+	UPROPERTY()
+	float CurrentValue = 0.0f;
+
+	void PostReplicatedAdd(const FGasXAttributeArray& InArraySerializer);
+	void PostReplicatedChange(const FGasXAttributeArray& InArraySerializer);
+
+private:
+	/** Current value the last change notification carried, so client notifications report the old value. */
+	float NotifiedValue = 0.0f;
+};
+
+/**
+ * Indexed attribute array replicated through FFastArraySerializer.
+ *
+ * WHY: Resistances, per-element bonuses or per-slot scalars would otherwise be dozens of FGameplayAttributeData
+ * properties, each compared every replication pass. Here each element is dirtied individually and delta replicated,
+ * so changing one element sends only that element.
+ *
+ * Elements are created on first write; unwritten elements read as the schema default on every machine and never
+ * replicate. Generated AttributeSets call Init() from their constructor and expose typed Get/Set accessors.
+ *
+ * NOTE: Elements are plain values, not FGameplayAttributes, so GameplayEffect modifiers cannot target them directly.
+ * Base writes also set the current value (there is no aggregator); SetCurrentValue() applies temporary changes.
+ */
+USTRUCT()
+struct GASXRUNTIME_API FGasXAttributeArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+public:
+	/** Upper bound on elements per array, matching the replicated uint16 index. */
+	static constexpr int32 MaxElements = 256;
+
+	/** Configure the array. Called from the owning set's constructor on server and clients alike. */
+	void Init(FName InArrayName, int32 InNumElements, float InDefaultValue);
+
+	FName GetArrayName() const { return ArrayName; }
+	int32 Num() const { return NumElements; }
+
+	float GetBaseValue(int32 Index) const;
+	float GetCurrentValue(int32 Index) const;
+
+	/** Set an element's base and current value. Only marks that element dirty, and only if it changed. */
+	void SetBaseValue(int32 Index, float NewValue);
+
+	/** Set an element's current value, leaving its base value alone. */
+	void SetCurrentValue(int32 Index, float NewValue);
+
+	/** Restore every written element to the default. Only elements that differ are dirtied. */
+	void ResetToDefaults();
+
+	/** Fired on the server for local writes and on clients for replicated ones. */
+	FGasXAttributeArrayElementChanged OnElementChanged;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FGasXAttributeArrayElement, FGasXAttributeArray>(Elements, DeltaParms, *this);
+	}
+
+private:
+	friend struct FGasXAttributeArrayElement;
+
+	const FGasXAttributeArrayElement* FindElement(int32 Index) const;
+	FGasXAttributeArrayElement* FindOrAddElement(int32 Index);
+
+	/** Written elements only, in write order. */
+	UPROPERTY()
+	TArray<FGasXAttributeArrayElement> Elements;
+
+	FName ArrayName;
+	int32 NumElements = 0;
+	float DefaultValue = 0.0f;
+};
+
+template<>
+struct TStructOpsTypeTraits<FGasXAttributeArray> : public TStructOpsTypeTraitsBase2<FGasXAttributeArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
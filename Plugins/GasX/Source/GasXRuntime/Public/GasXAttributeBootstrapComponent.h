@@ -6,10 +6,17 @@
 #include "AttributeSet.h"
 #include "Engine/DataTable.h"
 #include "GameplayEffect.h"
+#include "GasXReplicationLODSubsystem.h"
 #include "GasXAttributeBootstrapComponent.generated.h"
 
 class UAttributeSet;
 class UAbilitySystemComponent;
+class AController;
+class APawn;
+class UCurveTable;
+class UGasXBakedAttributeDefaults;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGasXAttributesReadySignature);
 
 /**
  * Lightweight helper that spawns Attribute Sets on the owner's Ability System Component
@@ -26,18 +33,77 @@ class GASXRUNTIME_API UGasXAttributeBootstrapComponent : public UActorComponent
 public:
 	UGasXAttributeBootstrapComponent();
 
+	virtual void PostLoad() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/**
+	 * Fires once per component lifetime when every set in `AttributeSetTypes` exists with its initial values:
+	 * right after bootstrap on the server, and on clients once the sets have replicated and run their first OnReps.
+	 * Lazy sets are not waited for. Check AreAttributesReady() first when binding late, or use the async node.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "GasX")
+	FGasXAttributesReadySignature OnAttributesReady;
+
+	/** True once OnAttributesReady has fired. */
+	UFUNCTION(BlueprintPure, Category = "GasX")
+	bool AreAttributesReady() const { return bAttributesReady; }
+
+	/**
+	 * Existing instance of SetClass on the owner's ASC, creating and initializing it first if it is a lazy set (server-only).
+	 *
+	 * @return The set, or nullptr if it does not exist and is not in `LazyAttributeSetTypes`
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GasX")
+	UAttributeSet* GetOrCreateAttributeSet(TSubclassOf<UAttributeSet> SetClass);
+
+	template <typename T>
+	T* GetOrCreateAttributeSet()
+	{
+		return Cast<T>(GetOrCreateAttributeSet(T::StaticClass()));
+	}
+
+	/**
+	 * The ASC this component bootstraps, resolved once and cached until the pawn is possessed by a different PlayerState:
+	 * IAbilitySystemInterface on the owner, then on the owning pawn's PlayerState, then a component on the owner.
+	 *
+	 * @return nullptr while the ASC is not reachable yet (e.g. a PlayerState-hosted ASC before possession)
+	 */
+	UAbilitySystemComponent* ResolveAbilitySystemComponent();
+
+	/** The uncached lookup behind ResolveAbilitySystemComponent(), for components that find the same ASC without a bootstrap. */
+	static UAbilitySystemComponent* FindAbilitySystemComponent(const AActor* Owner);
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Attribute sets to instantiate on BeginPlay if the owner exposes an ASC. */
 	UPROPERTY(EditAnywhere, Category = "GasX")
 	TArray<TSoftClassPtr<UAttributeSet>> AttributeSetTypes;
 
+	/**
+	 * Attribute sets created only when first needed: when an effect applied to the owner modifies one of their
+	 * attributes, or when code calls GetOrCreateAttributeSet(). Actors that never touch them pay no memory or replication cost.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GasX")
+	TArray<TSoftClassPtr<UAttributeSet>> LazyAttributeSetTypes;
+
+	/** Distance-based replication LOD for non-owning viewers, per set class (server-only). Sets without an entry replicate normally. */
+	UPROPERTY(EditAnywhere, Category = "GasX|Replication")
+	TArray<FGasXReplicationLODSetting> ReplicationLODSettings;
+
+	/**
+	 * If true, sets already on the ASC (respawn, PIE restart) are reset in place to their compiled defaults before init.
+	 * Otherwise they keep the values from the previous life.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GasX")
+	bool bResetExistingSets = true;
+
 	/** Optional metadata DataTable used to initialize attributes (editor-generated). */
 	UPROPERTY(EditAnywhere, Category = "GasX|Init")
 	UDataTable* AttributeMetadataTable = nullptr;
 
-	/** Optional Init GameplayEffect class to apply on initialization. Editor asset (optional). */
+	/** Optional Init GameplayEffect class to apply on initialization (e.g. a generated native UGE_Init<Set>). */
 	UPROPERTY(EditAnywhere, Category = "GasX|Init")
 	TSubclassOf<UGameplayEffect> InitGameplayEffect;
 
@@ -49,8 +115,49 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "GasX|Init")
 	bool bUseInitStatsDataTable = false;
 
+	/**
+	 * If true, initialize every generated set in `AttributeSetTypes` with one SetByCaller-driven effect (server-only).
+	 * Values come from `AttributeMetadataTable` rows when `bUseInitStatsDataTable` is set, otherwise from schema defaults.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GasX|Init")
+	bool bUseUniversalInitEffect = false;
+
+	/** Optional generated level CurveTable; when set, the universal init effect takes base values from it at `AttributeLevel`. */
+	UPROPERTY(EditAnywhere, Category = "GasX|Init")
+	UCurveTable* AttributeCurveTable = nullptr;
+
+	/** Level used to sample `AttributeCurveTable`. */
+	UPROPERTY(EditAnywhere, Category = "GasX|Init", meta = (ClampMin = "0"))
+	int32 AttributeLevel = 1;
+
+	/** Optional cook-baked defaults; used by the universal init effect when no metadata table row applies. */
+	UPROPERTY(EditAnywhere, Category = "GasX|Init")
+	UGasXBakedAttributeDefaults* BakedAttributeDefaults = nullptr;
+
+	/**
+	 * If true, edits to `AttributeMetadataTable` while the game runs are pushed to this actor's base values (server-only).
+	 * Only applies when the universal init effect reads from the table.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GasX|Init")
+	bool bApplyLiveTuning = true;
+
 #if WITH_AUTOMATION_TESTS
 public:
+	/** Test helper to enable the universal init effect path without editor setup. */
+	void TestSetUseUniversalInitEffect(bool bEnabled)
+	{
+		bUseUniversalInitEffect = bEnabled;
+	}
+
+	/** Test helper to select the DataTable and Init GameplayEffect paths without editor setup. */
+	void TestSetInitSources(UDataTable* MetadataTable, TSubclassOf<UGameplayEffect> InitEffect)
+	{
+		AttributeMetadataTable = MetadataTable;
+		bUseInitStatsDataTable = MetadataTable != nullptr;
+		InitGameplayEffect = InitEffect;
+		bUseInitGameplayEffect = InitEffect != nullptr;
+	}
+
 	/** Test helper so automation can inject attribute set classes without editor setup. */
 	void TestAddAttributeSetType(TSubclassOf<UAttributeSet> AttributeSetClass)
 	{
@@ -60,6 +167,15 @@ public:
 		}
 	}
 
+	/** Test helper to mark a set class lazy without editor setup. */
+	void TestAddLazyAttributeSetType(TSubclassOf<UAttributeSet> AttributeSetClass)
+	{
+		if (AttributeSetClass)
+		{
+			LazyAttributeSetTypes.Add(TSoftClassPtr<UAttributeSet>(AttributeSetClass.Get()));
+		}
+	}
+
 	/** Execute the BeginPlay initialization directly in automation environments. */
 	void RunBootstrapForTests()
 	{
@@ -69,9 +185,54 @@ public:
 
 private:
 	void ExecuteBootstrap();
-	/** Check if the ASC already contains an instance of AttributeSetClass. Prevents duplicates. */
-	bool HasAttributeSet(UAbilitySystemComponent* ASC, TSubclassOf<UAttributeSet> AttributeSetClass) const;
+	/** Find the ASC's existing instance of AttributeSetClass, if any. Prevents duplicates. */
+	UAttributeSet* FindAttributeSet(UAbilitySystemComponent* ASC, TSubclassOf<UAttributeSet> AttributeSetClass) const;
 
 	/** Initialize attributes on the ASC when required (server-only). */
 	void InitializeAttributes(UAbilitySystemComponent* ASC);
+
+	/** Apply the shared universal init effect for SetClasses in one spec (server-only). */
+	void ApplyUniversalInitEffect(UAbilitySystemComponent* ASC, TConstArrayView<const UClass*> SetClasses);
+
+	/** Hand the ASC's current sets to the replication LOD subsystem when LOD settings are configured. */
+	void RegisterReplicationLOD(UAbilitySystemComponent* ASC);
+
+	/** Create a lazy set on the ASC, initialize it and hand it to the telemetry and replication LOD subsystems. */
+	UAttributeSet* CreateLazySet(UAbilitySystemComponent* ASC, UClass* SetClass);
+
+	/** GameplayEffect application query: creates lazy sets an incoming effect modifies before it lands. */
+	bool OnEffectApplicationQuery(const FActiveGameplayEffectsContainer& ActiveEffects, const FGameplayEffectSpec& Spec);
+
+	/** Lazy set classes that have not been created on the ASC yet. */
+	UPROPERTY(Transient)
+	TArray<UClass*> PendingLazySetClasses;
+
+	/** Unregister from replication LOD, unbind the lazy set query from the cached ASC and clear the cache. */
+	void ReleaseAbilitySystemComponent();
+
+	/**
+	 * Bootstrap deferred until possession makes a PlayerState-hosted ASC reachable, and re-run when re-possession
+	 * by a different PlayerState moves the pawn to another ASC.
+	 */
+	UFUNCTION()
+	void HandleControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+	/**
+	 * Server's instances of `AttributeSetTypes`, replicated as object references.
+	 * WHY: A reference only maps on a client once the set subobject and the values in its initial bunch have arrived,
+	 * and the engine re-runs the OnRep as late references map, so readiness needs no polling.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_ReadyAttributeSets)
+	TArray<UAttributeSet*> ReadyAttributeSets;
+
+	UFUNCTION()
+	void OnRep_ReadyAttributeSets();
+
+	/** Set bAttributesReady and broadcast OnAttributesReady, once. */
+	void MarkAttributesReady();
+
+	bool bAttributesReady = false;
+
+	/** Result of ResolveAbilitySystemComponent(); also the ASC the lazy set query is bound to. */
+	TWeakObjectPtr<UAbilitySystemComponent> CachedASC;
 };
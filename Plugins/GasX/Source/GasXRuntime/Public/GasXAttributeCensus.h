@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * Census of one AttributeSet class across every ASC in a world.
+ */
+struct FGasXAttributeCensusEntry
+{
+	FName SetClassName;
+
+	int32 NumInstances = 0;
+
+	/** Instances the owning ASC replicates as subobjects. */
+	int32 NumReplicated = 0;
+
+	/** Sum over instances of class size, UObject array slot and heap memory owned through serialized containers. */
+	int64 TotalBytes = 0;
+
+	/** FGameplayAttributeData properties summed over instances, and how many of those still match the class default. */
+	int64 NumAttributes = 0;
+	int64 NumAttributesAtDefault = 0;
+
+	int64 GetBytesPerInstance() const { return NumInstances > 0 ? TotalBytes / NumInstances : 0; }
+	double GetDefaultFraction() const { return NumAttributes > 0 ? double(NumAttributesAtDefault) / double(NumAttributes) : 0.0; }
+};
+
+/**
+ * Memory and replication accounting for live AttributeSets, behind the GasX.Census console command.
+ *
+ * WHY: Capacity planning needs the actual per-set cost on a running server, not an estimate from headers.
+ *
+ * NOTE: Game thread only. Walks every object of the set classes, so it is meant for on-demand use, not per frame.
+ */
+class GASXRUNTIME_API FGasXAttributeCensus
+{
+public:
+	/**
+	 * Count every AttributeSet spawned on an ASC in World.
+	 *
+	 * @param OutEntries One entry per set class, largest total memory first
+	 * @return Number of ASCs visited
+	 */
+	static int32 Collect(const UWorld* World, TArray<FGasXAttributeCensusEntry>& OutEntries);
+
+	/** Format entries as CSV with a header row. */
+	static FString ToCsv(TConstArrayView<FGasXAttributeCensusEntry> Entries);
+};
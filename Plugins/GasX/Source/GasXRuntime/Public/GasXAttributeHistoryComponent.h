@@ -0,0 +1,131 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "AttributeSet.h"
+#include "GasXAttributeHistoryComponent.generated.h"
+
+class UAbilitySystemComponent;
+
+/**
+ * Fixed-capacity per-frame history of one AttributeSet's values, for lag compensation and rollback.
+ *
+ * WHY: Hit validation needs attribute values as of the frame the client saw, and snapshotting the set as a
+ * UObject every frame is far too expensive. Each recorded frame keeps a dirty mask of the attributes that
+ * changed since the previous record, plus the base and current value rows. Frame lookup is O(1) while frames
+ * are recorded back to back, which is the normal ticking case. Storage is allocated once when the set is
+ * first found, so recording never allocates after warm-up.
+ *
+ * Only FGameplayAttributeData properties are recorded (at most MaxAttributes); generated arrays and flags are not.
+ *
+ * NOTE: Records on the server only; clients never run rollback.
+ */
+UCLASS(ClassGroup = (GasX), meta = (BlueprintSpawnableComponent))
+class GASXRUNTIME_API UGasXAttributeHistoryComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** One dirty bit per attribute. */
+	static constexpr int32 MaxAttributes = 64;
+
+	UGasXAttributeHistoryComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/**
+	 * Record the set's current values as Frame. Ticking calls this with GFrameCounter when bAutoRecord is set.
+	 *
+	 * @param Frame Must be greater than the last recorded frame
+	 * @return true if a record was written
+	 */
+	bool RecordFrame(uint64 Frame);
+
+	/**
+	 * Value of an attribute as of Frame: the newest record at or before it.
+	 *
+	 * @return false if the attribute is not recorded or Frame is older than the history
+	 */
+	bool TryGetValueAtFrame(const FGameplayAttribute& Attribute, uint64 Frame, float& OutCurrentValue) const;
+
+	/** As TryGetValueAtFrame, for the base value. */
+	bool TryGetBaseValueAtFrame(const FGameplayAttribute& Attribute, uint64 Frame, float& OutBaseValue) const;
+
+	/**
+	 * Attributes that changed in the record for Frame, as bits in GetRecordedAttributes() order.
+	 *
+	 * @return false if Frame is outside the history
+	 */
+	bool TryGetDirtyMaskAtFrame(uint64 Frame, uint64& OutDirtyMask) const;
+
+	/**
+	 * Put every recorded attribute back at its base value as of Frame. Only attributes whose base differs are written.
+	 * Active effects then re-aggregate current values on top, as they would have at that frame.
+	 *
+	 * @return false if Frame is outside the history or the set is gone
+	 */
+	bool RestoreToFrame(uint64 Frame);
+
+	/** Drop every record; storage is kept. */
+	void ClearHistory();
+
+	/** Oldest and newest recorded frames; both 0 when nothing is recorded. */
+	uint64 GetOldestFrame() const;
+	uint64 GetNewestFrame() const;
+
+	/** Attributes covered by the history, in dirty-bit order. */
+	const TArray<FGameplayAttribute>& GetRecordedAttributes() const { return Attributes; }
+
+protected:
+	virtual void BeginPlay() override;
+
+	/** Set whose attributes are recorded; the instance is looked up on the ASC the owner reaches (itself or its PlayerState). */
+	UPROPERTY(EditAnywhere, Category = "GasX|History")
+	TSubclassOf<UAttributeSet> AttributeSetClass;
+
+	/** Frames kept. Lag compensation needs at least the worst accepted latency in frames. */
+	UPROPERTY(EditAnywhere, Category = "GasX|History", meta = (ClampMin = "2", ClampMax = "1024"))
+	int32 Capacity = 32;
+
+	/** If true, record every tick on the server. Otherwise the owner calls RecordFrame() with its own frame numbers. */
+	UPROPERTY(EditAnywhere, Category = "GasX|History")
+	bool bAutoRecord = true;
+
+private:
+	/** Find the set and size the ring. Returns false until the set exists on the ASC. */
+	bool BindSet();
+
+	/** Ring slot of the newest record at or before Frame, or INDEX_NONE. */
+	int32 FindSlot(uint64 Frame) const;
+
+	/** Ring slot of the Nth oldest record. */
+	int32 LogicalToSlot(int32 LogicalIndex) const;
+
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	TWeakObjectPtr<UAttributeSet> BoundSet;
+	TArray<FGameplayAttribute> Attributes;
+
+	/** Per slot. */
+	TArray<uint64> SlotFrames;
+	TArray<uint64> SlotDirtyMasks;
+
+	/** Attributes.Num() values per slot, slots back to back. */
+	TArray<float> BaseValues;
+	TArray<float> CurrentValues;
+
+	/** Slot of the newest record. */
+	int32 Head = INDEX_NONE;
+	int32 NumRecorded = 0;
+
+#if WITH_AUTOMATION_TESTS
+public:
+	/** Test helper to configure the component without editor setup. */
+	void TestConfigure(TSubclassOf<UAttributeSet> SetClass, int32 InCapacity)
+	{
+		AttributeSetClass = SetClass;
+		Capacity = InCapacity;
+		bAutoRecord = false;
+	}
+#endif
+};
@@ -0,0 +1,161 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class AActor;
+class FGasXJournalWriter;
+class UAttributeSet;
+struct FGameplayAttribute;
+struct FGameplayEffectModCallbackData;
+
+/**
+ * GAMEPLAYATTRIBUTE_VALUE_SETTER that also journals the change. Emitted by the generator for "bJournal" schemas.
+ */
+#define GASX_JOURNALED_VALUE_SETTER(PropertyName) \
+	FORCEINLINE void Set##PropertyName(float NewVal) \
+	{ \
+		UAbilitySystemComponent* AbilityComp = GetOwningAbilitySystemComponent(); \
+		if (ensure(AbilityComp)) \
+		{ \
+			const float OldVal = AbilityComp->GetNumericAttributeBase(Get##PropertyName##Attribute()); \
+			AbilityComp->SetNumericAttributeBase(Get##PropertyName##Attribute(), NewVal); \
+			FGasXAttributeJournal::Record(this, Get##PropertyName##Attribute(), OldVal, NewVal); \
+		} \
+	}
+
+/**
+ * One journaled attribute change.
+ */
+struct FGasXJournalEntry
+{
+	/** GFrameCounter when the change was recorded */
+	uint64 Frame = 0;
+
+	/** Owning actor name and UniqueID; names alone repeat across respawns */
+	FName Who;
+	uint32 WhoId = 0;
+
+	FName Attribute;
+
+	/** Executing GameplayEffect class, or NAME_None for a direct setter call */
+	FName Cause;
+
+	float OldValue = 0.0f;
+	float NewValue = 0.0f;
+};
+
+/**
+ * Server-side journal of attribute changes for live-ops analytics.
+ *
+ * WHY: Logging every change on the game thread costs far more than the change itself. Producers copy a
+ * fixed-size entry into a bounded lock-free MPSC ring and return; a background thread drains the ring into
+ * compact binary files (.gxj) that rotate at GasX.Journal.MaxFileMB. When the ring is full the entry is
+ * dropped and counted rather than blocking the caller.
+ *
+ * Generated sets with "bJournal" in their schema append from their setters and Pre/PostGameplayEffectExecute.
+ * Per-attribute sampling comes from GasX.Journal.SampleRates (e.g. "Health=1,Stamina=0.05"), read at Start().
+ *
+ * NOTE: Start() and Stop() are game thread only; Append() and the Record helpers are safe from any thread.
+ * Stop() waits for producers already inside Append() or a Record helper, so a restart never hands their slots
+ * to the next session.
+ */
+class GASXRUNTIME_API FGasXAttributeJournal
+{
+public:
+	/** Ring slots; a power of two. */
+	static constexpr uint32 Capacity = 1u << 16;
+
+	static FGasXAttributeJournal& Get();
+
+	~FGasXAttributeJournal();
+
+	/**
+	 * Open a new journal file in Directory and start the writer thread.
+	 *
+	 * @return true if the journal is running
+	 */
+	bool Start(const FString& Directory);
+
+	/** Wait for in-flight producers, drain every queued entry, close the file and stop the writer thread. */
+	void Stop();
+
+	bool IsRunning() const { return bRunning.load(std::memory_order_relaxed); }
+
+	/**
+	 * Queue an entry. Never blocks.
+	 *
+	 * @return false if the journal is stopped or the ring is full (counted in GetNumDropped())
+	 */
+	bool Append(const FGasXJournalEntry& Entry);
+
+	/** Journal a direct change on a server-owned set, subject to sampling. */
+	static void Record(const UAttributeSet* Set, const FGameplayAttribute& Attribute, float OldValue, float NewValue, FName Cause = NAME_None);
+
+	/** Called from generated PreGameplayEffectExecute to remember the value before the effect lands. */
+	static void BeginEffectExecute(const FGameplayEffectModCallbackData& Data);
+
+	/** Called from generated PostGameplayEffectExecute to journal the change with the effect as its cause. */
+	static void EndEffectExecute(const FGameplayEffectModCallbackData& Data);
+
+	/** Entries dropped because the ring was full, since the last Start(). */
+	uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+	/** Entries written to disk since the last Start(). */
+	uint64 GetNumWritten() const { return NumWritten.load(std::memory_order_relaxed); }
+
+	/** Path of the file currently being written, empty when stopped. */
+	FString GetCurrentFilePath() const;
+
+	/**
+	 * Read a journal file back, for analytics tooling and tests.
+	 *
+	 * @return false if the file is missing or not a journal
+	 */
+	static bool ReadFile(const FString& FilePath, TArray<FGasXJournalEntry>& OutEntries);
+
+private:
+	friend class FGasXJournalWriter;
+
+	FGasXAttributeJournal();
+
+	bool TryPop(FGasXJournalEntry& OutEntry);
+
+	/** Counts the calling producer in NumActiveProducers while it may touch the ring or the sample rates. */
+	struct FProducerScope;
+
+	static void RecordForOwner(const AActor* Owner, FName Attribute, float OldValue, float NewValue, FName Cause);
+
+	/** Sampling decision for Attribute; lock-free reads of the rates parsed at Start(). */
+	bool ShouldSample(FName Attribute);
+
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence;
+		FGasXJournalEntry Entry;
+	};
+
+	TUniquePtr<FSlot[]> Slots;
+
+	/** Next position producers claim; on its own cache line so producers do not false-share with the consumer. */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePos{0};
+
+	/** Next position the writer thread reads. */
+	alignas(PLATFORM_CACHE_LINE_SIZE) uint64 DequeuePos = 0;
+
+	std::atomic<uint64> NumDropped{0};
+	std::atomic<uint64> NumWritten{0};
+	std::atomic<uint32> SampleCounter{0};
+	std::atomic<bool> bRunning{false};
+
+	/** Producers past their running check; Stop() waits for this to reach zero before the ring can be reset. */
+	std::atomic<int32> NumActiveProducers{0};
+
+	/** Immutable while running. */
+	TMap<FName, float> SampleRates;
+	float DefaultSampleRate = 1.0f;
+
+	TUniquePtr<FGasXJournalWriter> Writer;
+};
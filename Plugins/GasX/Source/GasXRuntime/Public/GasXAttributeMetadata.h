@@ -34,4 +34,43 @@ public:
 	/** Designer-facing description of what this attribute represents */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attribute")
 	FString Description;
+
+#if WITH_EDITORONLY_DATA
+	/**
+	 * Schema values this row was last generated from.
+	 * WHY: A field that still matches its snapshot has not been touched by a designer and can follow the schema;
+	 * a field that differs is designer-owned and survives regeneration.
+	 */
+	UPROPERTY()
+	double GeneratedBaseValue = 0.0;
+
+	UPROPERTY()
+	double GeneratedMinValue = 0.0;
+
+	UPROPERTY()
+	double GeneratedMaxValue = 0.0;
+
+	UPROPERTY()
+	FString GeneratedDescription;
+
+	UPROPERTY()
+	bool bHasGeneratedSnapshot = false;
+#endif
+
+#if WITH_EDITOR
+	/** True if this row was written by the generator (and so may be removed when its attribute leaves the schema). */
+	bool HasGeneratedSnapshot() const { return bHasGeneratedSnapshot; }
+
+	/** Record the current values as the generated snapshot. */
+	void RecordGeneratedSnapshot();
+
+	/**
+	 * Three-way merge freshly generated values into this row.
+	 * Fields still equal to the snapshot take the new value; designer-edited fields are kept.
+	 * Rows generated before snapshots existed take the new values, matching the old overwrite behavior.
+	 *
+	 * @return true if any field (including the snapshot) changed
+	 */
+	bool MergeGeneratedValues(const FGasXAttributeMetadataRow& Generated);
+#endif
 };
@@ -0,0 +1,107 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "GasXAttributeTelemetrySubsystem.generated.h"
+
+class UAttributeSet;
+
+/**
+ * Distribution of one tracked metric across every registered set, as of the last snapshot.
+ */
+struct FGasXAttributeDistribution
+{
+	/** Attribute name, or "Numerator/Denominator" for a ratio metric */
+	FName Metric;
+
+	int32 Count = 0;
+	float Min = 0.0f;
+	float Max = 0.0f;
+	float Mean = 0.0f;
+	float P50 = 0.0f;
+	float P90 = 0.0f;
+	float P99 = 0.0f;
+
+	/** Samples below GasX.Telemetry.LowThreshold: of 1.0 for ratios, of Max otherwise */
+	int32 NumLow = 0;
+
+	/** Equal-width buckets over [Min, Max] */
+	TArray<int32> Buckets;
+};
+
+/**
+ * Periodic server-wide histograms and percentiles of attribute values, e.g. Health/MaxHealth across all players.
+ *
+ * WHY: Operations want live distributions without walking actors on the game thread. Every
+ * GasX.Telemetry.IntervalSeconds the game thread only copies tracked values out of the registered sets into one
+ * contiguous buffer per metric; a worker task then computes the statistics with ParallelFor and the results are
+ * picked up on a later tick. Results are printed by GasX.Telemetry.Dump and recorded as CSV profiler stats.
+ *
+ * Metrics come from GasX.Telemetry.Metrics, a comma list of attribute names or Numerator/Denominator ratios.
+ *
+ * NOTE: Server only; the bootstrap registers the sets it spawns.
+ */
+UCLASS()
+class GASXRUNTIME_API UGasXAttributeTelemetrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Include Set in future snapshots. Sets are held weakly and dropped once destroyed. */
+	void RegisterSet(const UAttributeSet* Set);
+
+	/** Results of the last completed snapshot. */
+	const TArray<FGasXAttributeDistribution>& GetDistributions() const { return Distributions; }
+
+	/**
+	 * Compute the distribution of Values; sorts Values in place. Used by the worker task and exposed for tests.
+	 *
+	 * @param bRatio Values are fractions, so the low threshold applies to 1.0 instead of the observed max
+	 */
+	static FGasXAttributeDistribution ComputeDistribution(FName Metric, TArray<float>& Values, bool bRatio, float LowThreshold, int32 NumBuckets);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FMetric
+	{
+		FName Name;
+		FName Numerator;
+		FName Denominator;
+	};
+
+	struct FSnapshot
+	{
+		TArray<FName> MetricNames;
+		TArray<bool> RatioMetrics;
+		TArray<TArray<float>> Values;
+		float LowThreshold = 0.2f;
+		int32 NumBuckets = 20;
+	};
+
+	/** Copy tracked values into a snapshot. The only game-thread work per interval. */
+	void TakeSnapshot(FSnapshot& OutSnapshot);
+
+	/** Rebuild Metrics when GasX.Telemetry.Metrics changes. */
+	void RefreshMetrics();
+
+	/** Attribute properties of a set class per metric (numerator, denominator); cached per class. */
+	const TArray<TPair<FProperty*, FProperty*>>& GetMetricProperties(const UClass* SetClass);
+
+	void PublishResults(TArray<FGasXAttributeDistribution>&& Results);
+
+	TSet<TWeakObjectPtr<const UAttributeSet>> Sets;
+	TArray<FMetric> Metrics;
+	FString MetricsSpec;
+	TMap<const UClass*, TArray<TPair<FProperty*, FProperty*>>> MetricPropertiesByClass;
+
+	TArray<FGasXAttributeDistribution> Distributions;
+	UE::Tasks::TTask<TArray<FGasXAttributeDistribution>> PendingTask;
+	double TimeSinceSnapshot = 0.0;
+};
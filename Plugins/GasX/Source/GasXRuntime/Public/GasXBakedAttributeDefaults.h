@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/BulkData.h"
+#include "UObject/Object.h"
+#include "GasXBakedAttributeDefaults.generated.h"
+
+class UDataTable;
+
+/**
+ * One baked attribute default. Plain data, 16 bytes, no padding.
+ * WHY: Stored back to back in bulk data so the payload can be memcpy'd or memory mapped as-is.
+ */
+struct alignas(16) FGasXBakedAttributeDefault
+{
+	float BaseValue = 0.0f;
+	float MinValue = 0.0f;
+	float MaxValue = 0.0f;
+	uint32 Reserved = 0;
+};
+static_assert(sizeof(FGasXBakedAttributeDefault) == 16, "Baked defaults must stay a tightly packed 16-byte POD");
+
+/** Range of baked rows that came from one metadata DataTable. */
+USTRUCT()
+struct GASXRUNTIME_API FGasXBakedTableRange
+{
+	GENERATED_BODY()
+
+	/** Object name of the source metadata table (e.g. PlayerCoreAttributesMetadata) */
+	UPROPERTY(VisibleAnywhere, Category = "GasX")
+	FName TableName;
+
+	/** Index of the table's first row in the value and name arrays */
+	UPROPERTY(VisibleAnywhere, Category = "GasX")
+	int32 FirstRow = 0;
+
+	UPROPERTY(VisibleAnywhere, Category = "GasX")
+	int32 NumRows = 0;
+};
+
+/**
+ * Read-only, cook-baked copy of every FGasXAttributeMetadataRow DataTable in the project.
+ *
+ * WHY: Metadata tables ship a Description string per row and need the DataTable row-map at runtime.
+ * The baked asset keeps only names plus a flat array of POD values in bulk data that is flagged for
+ * memory mapping, so several server processes on one host can share the same read-only pages.
+ * Descriptions are editor-only data and are stripped on cook.
+ *
+ * The asset rebakes itself from the asset registry whenever it is saved for cook; GasX.BakeAttributeDefaults
+ * creates or refreshes it in the editor.
+ */
+UCLASS()
+class GASXRUNTIME_API UGasXBakedAttributeDefaults : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UObject Interface
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void BeginDestroy() override;
+#if WITH_EDITOR
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+#endif
+	//~ End UObject Interface
+
+	/**
+	 * Find the baked default for an attribute row of a metadata table.
+	 *
+	 * @param TableName Object name of the source metadata table
+	 * @param RowName Attribute (row) name
+	 * @return The baked value, or nullptr if the table or row was not baked. Valid until the asset is next saved or loaded.
+	 */
+	const FGasXBakedAttributeDefault* Find(FName TableName, FName RowName) const;
+
+	/** All baked values, in row order. Resolves the bulk payload on first call; the view is valid until the next save or load. */
+	TConstArrayView<FGasXBakedAttributeDefault> GetValues() const;
+
+	int32 GetNumRows() const { return RowNames.Num(); }
+
+#if WITH_EDITOR
+	/** Rebuild the baked data from the given metadata tables (non-metadata tables are skipped). */
+	void Bake(TConstArrayView<const UDataTable*> Tables);
+
+	/** Rebuild the baked data from every FGasXAttributeMetadataRow DataTable known to the asset registry. */
+	void BakeAllMetadataTables();
+#endif
+
+private:
+	void ReleaseValues() const;
+
+	UPROPERTY(VisibleAnywhere, Category = "GasX")
+	TArray<FGasXBakedTableRange> Tables;
+
+	/** Row name of each baked value, parallel to the bulk payload. */
+	UPROPERTY(VisibleAnywhere, Category = "GasX")
+	TArray<FName> RowNames;
+
+#if WITH_EDITORONLY_DATA
+	/** Row descriptions, parallel to RowNames. Editor only; never cooked. */
+	UPROPERTY(VisibleAnywhere, Category = "GasX")
+	TArray<FString> Descriptions;
+#endif
+
+	/** Packed FGasXBakedAttributeDefault array. */
+	FByteBulkData ValueBulkData;
+
+	/** View into the locked bulk payload, resolved lazily so loading never blocks on it; released on save and load. */
+	mutable const FGasXBakedAttributeDefault* ResolvedValues = nullptr;
+	mutable bool bValuesLocked = false;
+};
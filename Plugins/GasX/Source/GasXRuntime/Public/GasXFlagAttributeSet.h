@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "GasXFlagAttributeSet.generated.h"
+
+/** Broadcast when flag bits change, locally or through replication. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FGasXAttributeFlagsChanged, uint64 /*ChangedMask*/, uint64 /*NewFlagBits*/);
+
+/**
+ * Base for generated AttributeSets that declare flag attributes (AttributeType "flag").
+ *
+ * WHY: States such as Stunned or InCombat modelled as 0/1 float attributes cost an FGameplayAttributeData and
+ * a property compare each. Flags are packed into one replicated uint64 per set, so 40 status flags replicate
+ * in 8 bytes. Generated subclasses add a <Flag>Flag mask plus Is<Flag>()/Set<Flag>() per flag.
+ *
+ * NOTE: Flags are not FGameplayAttributes. GameplayEffects set them through UGasXFlagsGameplayEffectComponent
+ * and read them as magnitudes through UGasXFlagMagnitudeCalculation.
+ */
+UCLASS(Abstract)
+class GASXRUNTIME_API UGasXFlagAttributeSet : public UAttributeSet
+{
+	GENERATED_BODY()
+
+public:
+	/** Flags per set, one per bit of FlagBits. */
+	static constexpr int32 MaxFlags = 64;
+
+	uint64 GetFlagBits() const { return FlagBits; }
+
+	/** True if every bit in Mask is set. */
+	bool TestFlagBits(uint64 Mask) const { return (FlagBits & Mask) == Mask; }
+
+	/** True if any bit in Mask is set. */
+	bool TestAnyFlagBits(uint64 Mask) const { return (FlagBits & Mask) != 0; }
+
+	/**
+	 * Set or clear every bit in Mask in the base bits (schema defaults plus instant writes).
+	 * A bit held by an active grant stays set until the grant ends. Writes made on clients are
+	 * overwritten by the next replicated value.
+	 */
+	void SetFlagBits(uint64 Mask, bool bValue);
+
+	/**
+	 * Reference-counted set used by GameplayEffects with a duration.
+	 * The bits stay set until the last grant is removed, however many effects grant them; removing
+	 * the last grant falls back to the base bits rather than clearing the flag.
+	 */
+	void AddFlagGrant(uint64 Mask);
+	void RemoveFlagGrant(uint64 Mask);
+
+	/** Schema names of this set's flags, indexed by bit. Overridden by generated sets. */
+	virtual TConstArrayView<FName> GetFlagNames() const { return {}; }
+
+	/** Mask of a named flag, or 0 if this set has no such flag. */
+	uint64 FindFlagMask(FName FlagName) const;
+
+	/** Fired on the server for local writes and on clients for replicated ones. */
+	FGasXAttributeFlagsChanged OnFlagsChanged;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+#if WITH_AUTOMATION_TESTS
+	/** Test hook for sets whose schema defaults are not all false. */
+	void TestInitFlagBits(uint64 InDefaultFlagBits) { InitFlagBits(InDefaultFlagBits); }
+#endif
+
+protected:
+	/** Set the compiled default bits. Called from generated constructors. */
+	void InitFlagBits(uint64 InDefaultFlagBits);
+
+	/**
+	 * Restore the compiled default base bits. Called from generated ResetToDefaults().
+	 * Grants of still-active effects are kept, like their attribute modifiers; they end when the effects are removed.
+	 */
+	void ResetFlagBits();
+
+	UFUNCTION()
+	void OnRep_FlagBits(uint64 OldFlagBits);
+
+	/** Every flag of the set, bit N being GetFlagNames()[N]. Always BaseFlagBits | GrantedFlagBits. */
+	UPROPERTY(ReplicatedUsing = OnRep_FlagBits)
+	uint64 FlagBits = 0;
+
+	/** Bits set by the schema defaults. */
+	uint64 DefaultFlagBits = 0;
+
+private:
+	/** Recompute FlagBits from the base and granted bits and notify if it changed. */
+	void UpdateFlagBits();
+
+	/**
+	 * Schema defaults plus instant writes, kept apart from grants so a grant ending never clears a bit
+	 * that was already set. On clients this mirrors the replicated FlagBits.
+	 */
+	uint64 BaseFlagBits = 0;
+
+	/** Bits with at least one active grant. Only maintained where effects are applied (the server). */
+	uint64 GrantedFlagBits = 0;
+
+	/** Active grants per bit. Only maintained where effects are applied (the server). */
+	uint16 GrantCounts[MaxFlags] = {};
+};
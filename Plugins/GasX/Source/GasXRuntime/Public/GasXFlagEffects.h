@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectComponent.h"
+#include "GameplayModMagnitudeCalculation.h"
+#include "GasXFlagEffects.generated.h"
+
+class UAbilitySystemComponent;
+class UGasXFlagAttributeSet;
+
+/**
+ * Sets flag attributes of the target from a GameplayEffect.
+ *
+ * Instant effects set SetFlags and clear ClearFlags permanently. Duration and infinite effects grant SetFlags
+ * while active (reference counted, so overlapping stuns keep Stunned until the last one ends); ClearFlags is
+ * ignored for them.
+ *
+ * WHY: Flags are bits of one packed property rather than FGameplayAttributes, so modifiers cannot target them.
+ */
+UCLASS(DisplayName = "GasX Flags")
+class GASXRUNTIME_API UGasXFlagsGameplayEffectComponent : public UGameplayEffectComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** Generated set declaring the flags */
+	UPROPERTY(EditDefaultsOnly, Category = "Flags")
+	TSubclassOf<UGasXFlagAttributeSet> AttributeSetClass;
+
+	/** Schema names of the flags to set */
+	UPROPERTY(EditDefaultsOnly, Category = "Flags")
+	TArray<FName> SetFlags;
+
+	/** Schema names of the flags to clear (instant effects only) */
+	UPROPERTY(EditDefaultsOnly, Category = "Flags")
+	TArray<FName> ClearFlags;
+
+	virtual bool OnActiveGameplayEffectAdded(FActiveGameplayEffectsContainer& ActiveGEContainer, FActiveGameplayEffect& ActiveGE) const override;
+	virtual void OnGameplayEffectExecuted(FActiveGameplayEffectsContainer& ActiveGEContainer, FGameplayEffectSpec& GESpec, FPredictionKey& PredictionKey) const override;
+
+private:
+	void OnActiveGameplayEffectRemoved(const FGameplayEffectRemovalInfo& RemovalInfo, FActiveGameplayEffectsContainer* ActiveGEContainer) const;
+
+	UGasXFlagAttributeSet* FindFlagSet(const UAbilitySystemComponent* AbilitySystem) const;
+	uint64 ResolveMask(const UGasXFlagAttributeSet& FlagSet, const TArray<FName>& FlagNames) const;
+};
+
+/**
+ * Reads one flag of the effect's source as a magnitude: SetMagnitude when set, ClearMagnitude otherwise.
+ *
+ * WHY: Lets effects scale by a state ("double damage while the attacker is InCombat") without mirroring the
+ * flag into a float attribute.
+ *
+ * NOTE: Magnitude calculations only see the spec, so the flag is read from the instigator's AbilitySystemComponent.
+ */
+UCLASS(DisplayName = "GasX Flag Magnitude")
+class GASXRUNTIME_API UGasXFlagMagnitudeCalculation : public UGameplayModMagnitudeCalculation
+{
+	GENERATED_BODY()
+
+public:
+	/** Generated set declaring the flag */
+	UPROPERTY(EditDefaultsOnly, Category = "Flags")
+	TSubclassOf<UGasXFlagAttributeSet> AttributeSetClass;
+
+	/** Schema name of the flag */
+	UPROPERTY(EditDefaultsOnly, Category = "Flags")
+	FName FlagName;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Flags")
+	float SetMagnitude = 1.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Flags")
+	float ClearMagnitude = 0.0f;
+
+	virtual float CalculateBaseMagnitude_Implementation(const FGameplayEffectSpec& Spec) const override;
+};
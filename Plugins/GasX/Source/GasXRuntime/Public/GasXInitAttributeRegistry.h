@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * One attribute a generated AttributeSet contributes to the universal init effect.
+ */
+struct FGasXInitAttribute
+{
+	/** Attribute the init modifier targets */
+	FGameplayAttribute Attribute;
+
+	/** SetByCaller tag the bootstrap fills with the attribute's starting value */
+	FGameplayTag SetByCallerTag;
+
+	/** Schema default, used when no metadata row overrides it */
+	float DefaultValue = 0.0f;
+};
+
+/**
+ * Registry of the init attributes declared by generated AttributeSets.
+ *
+ * WHY: Generated sets register themselves at static-init time, so the universal init effect can cover
+ * every set on an actor without the bootstrap knowing the generated classes. Attribute lookup is
+ * deferred until first use because UClass and FProperty data do not exist during static init.
+ *
+ * NOTE: Game thread only.
+ */
+class GASXRUNTIME_API FGasXInitAttributeRegistry
+{
+public:
+	using FStaticClassFunc = UClass* (*)();
+	using FDescribeFunc = void (*)(TArray<FGasXInitAttribute>&);
+
+	static FGasXInitAttributeRegistry& Get();
+
+	void Register(FStaticClassFunc StaticClassFunc, FDescribeFunc DescribeFunc);
+	void Unregister(FStaticClassFunc StaticClassFunc);
+
+	/** Init attributes of a generated set, or nullptr if the class never registered. */
+	const TArray<FGasXInitAttribute>* Find(const UClass* SetClass);
+
+	/** Changes whenever a set registers or unregisters, so cached effects can be rebuilt. */
+	uint32 GetSerial() const { return Serial; }
+
+private:
+	struct FEntry
+	{
+		FStaticClassFunc StaticClassFunc = nullptr;
+		FDescribeFunc DescribeFunc = nullptr;
+		bool bDescribed = false;
+		TArray<FGasXInitAttribute> Attributes;
+	};
+
+	TArray<FEntry> Entries;
+	uint32 Serial = 0;
+};
+
+/**
+ * Static registration helper emitted into generated AttributeSet sources.
+ * Registers on construction (module load) and unregisters on destruction (module unload).
+ */
+struct FGasXInitAttributeRegistration
+{
+	FGasXInitAttributeRegistration(FGasXInitAttributeRegistry::FStaticClassFunc InStaticClassFunc, FGasXInitAttributeRegistry::FDescribeFunc DescribeFunc)
+		: StaticClassFunc(InStaticClassFunc)
+	{
+		FGasXInitAttributeRegistry::Get().Register(StaticClassFunc, DescribeFunc);
+	}
+
+	~FGasXInitAttributeRegistration()
+	{
+		FGasXInitAttributeRegistry::Get().Unregister(StaticClassFunc);
+	}
+
+private:
+	FGasXInitAttributeRegistry::FStaticClassFunc StaticClassFunc;
+};
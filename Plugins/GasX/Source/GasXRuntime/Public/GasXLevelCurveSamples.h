@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCurveTable;
+
+/**
+ * Dense per-level samples of every curve in a generated level CurveTable.
+ *
+ * WHY: Bootstrapping a high-level actor should be an array index, not curve evaluation plus GE math.
+ * Each row is sampled once at integer levels 0..MaxLevel into one contiguous array; levels outside
+ * the sampled range clamp to the nearest end.
+ *
+ * Samples are shared per table and rebuilt when the table broadcasts OnCurveTableChanged (reimport or
+ * regeneration in the editor).
+ *
+ * NOTE: Game thread only.
+ */
+class GASXRUNTIME_API FGasXLevelCurveSamples
+{
+public:
+	/** Upper bound on sampled levels, so a stray key at level 100000 cannot allocate unbounded memory. */
+	static constexpr int32 MaxSampledLevel = 1000;
+
+	/**
+	 * Shared samples for a table, built on first request after the table loads.
+	 *
+	 * @return Samples, or nullptr if Table is null
+	 */
+	static TSharedPtr<const FGasXLevelCurveSamples> Get(UCurveTable* Table);
+
+	/**
+	 * Look up a row's value at a level.
+	 *
+	 * @return true if the table has a curve for RowName
+	 */
+	bool TryGetValue(FName RowName, int32 Level, float& OutValue) const;
+
+	/** Highest sampled level. */
+	int32 GetMaxLevel() const { return MaxLevel; }
+
+private:
+	void Sample(const UCurveTable& Table);
+
+	/** Row name -> offset of its level 0 sample in Values. */
+	TMap<FName, int32> RowOffsets;
+
+	/** (MaxLevel + 1) samples per row, rows back to back. */
+	TArray<float> Values;
+
+	int32 MaxLevel = 0;
+};
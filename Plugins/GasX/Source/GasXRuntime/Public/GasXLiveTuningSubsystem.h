@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GasXLiveTuningSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UCurveTable;
+class UDataTable;
+
+/**
+ * Pushes metadata DataTable edits to live actors without respawning them.
+ *
+ * WHY: Balancing on a running server should not mean respawning everything. When a watched table changes
+ * (an editor edit during PIE, or GasX.LiveTuning.ImportJson on a server) its rows are diffed against the last
+ * snapshot and only the changed rows are applied, to every ASC that was initialized from the table.
+ * The rollout runs on a per-frame time budget (GasX.LiveTuning.BudgetMs), so retuning thousands of actors
+ * spreads over several frames instead of hitching one.
+ *
+ * A change is applied as a delta: each actor's current base value moves by (new default - old default), so
+ * an actor at 60/100 Health becomes 80/120 when the default goes to 120 instead of being healed to full. A row
+ * with no previous value takes the set's compiled default as its old default.
+ *
+ * NOTE: Server only; clients receive the new values through attribute replication. Attributes the actor takes
+ * from a level curve are left alone, matching the init precedence of UGasXUniversalInitEffect.
+ */
+UCLASS()
+class GASXRUNTIME_API UGasXLiveTuningSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Retune ASC whenever MetadataTable changes. Called by the bootstrap for actors it initialized from a table.
+	 *
+	 * @param ASC Server-side AbilitySystemComponent
+	 * @param MetadataTable FGasXAttributeMetadataRow table the actor was initialized from
+	 * @param LevelCurves Optional level CurveTable whose rows take precedence over the metadata table
+	 */
+	void RegisterTarget(UAbilitySystemComponent* ASC, UDataTable* MetadataTable, UCurveTable* LevelCurves = nullptr);
+
+	/** Actors still waiting for an in-flight rollout. */
+	int32 GetNumPendingTargets() const;
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FTarget
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		TWeakObjectPtr<UCurveTable> LevelCurves;
+	};
+
+	struct FWatchedTable
+	{
+		TWeakObjectPtr<UDataTable> Table;
+		FDelegateHandle ChangedHandle;
+
+		/** Base value per row as of the last change, for diffing. */
+		TMap<FName, double> BaseValues;
+
+		TArray<FTarget> Targets;
+	};
+
+	struct FRollout
+	{
+		/** Changed rows: new base value, and the previous one if the row existed before. */
+		TMap<FName, TPair<double, TOptional<double>>> ChangedValues;
+
+		TArray<FTarget> Targets;
+		int32 NextTarget = 0;
+	};
+
+	void OnTableChanged(TWeakObjectPtr<UDataTable> Table);
+	void ApplyRollout(const FRollout& Rollout, const FTarget& Target) const;
+
+	static TMap<FName, double> SnapshotBaseValues(const UDataTable& Table);
+
+	TArray<FWatchedTable> WatchedTables;
+
+	/** In-flight rollouts, oldest first so later edits win. */
+	TArray<FRollout> Rollouts;
+};
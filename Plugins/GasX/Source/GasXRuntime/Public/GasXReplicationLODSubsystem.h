@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GasXReplicationLODSubsystem.generated.h"
+
+class AActor;
+class APlayerController;
+class UAbilitySystemComponent;
+class UAttributeSet;
+
+/**
+ * Replication LOD policy for one AttributeSet class on an actor.
+ */
+USTRUCT(BlueprintType)
+struct GASXRUNTIME_API FGasXReplicationLODSetting
+{
+	GENERATED_BODY()
+
+	/** Set the policy applies to */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GasX|Replication")
+	TSoftClassPtr<UAttributeSet> AttributeSetClass;
+
+	/** Viewers within this distance receive every update */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GasX|Replication", meta = (ClampMin = "0", Units = "cm"))
+	float FullRateDistance = 3000.0f;
+
+	/**
+	 * Viewers further away receive one refresh per interval. 0 sends only the first refresh, so the set exists on
+	 * their client, and nothing more until they come closer.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GasX|Replication", meta = (ClampMin = "0", Units = "s"))
+	float FarUpdateInterval = 1.0f;
+};
+
+/**
+ * Per-connection replication LOD for generated AttributeSets, based on distance to each connection's view point.
+ *
+ * WHY: In large matches most viewers are far from most actors, yet every attribute change replicated to all of
+ * them at full rate. Each managed set is registered as a COND_NetGroup subobject in a group of its own; every
+ * GasX.ReplicationLOD.EvaluateHz the subsystem puts each player controller in or out of that group. Nearby
+ * viewers stay in it. Far viewers are let in when first seen and then once per FarUpdateInterval; the replicating actor is forced to
+ * update and the viewer stays in the group for at least one of its net update periods, so the refresh is sent
+ * even by slow-updating owners such as a PlayerState. The owning connection is always in it, so owners keep
+ * full fidelity.
+ *
+ * NOTE: The unit of LOD is the set. Attributes distant viewers should keep at a higher rate (e.g. Health) belong
+ * in their own small set with a larger FullRateDistance. Server only; requires the registered subobject list.
+ */
+UCLASS()
+class GASXRUNTIME_API UGasXReplicationLODSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Put Actor's sets under LOD. Re-registering replaces the previous registration, e.g. after a lazy set was created.
+	 *
+	 * @param Actor Actor the sets belong to, e.g. a pawn whose ASC lives on its PlayerState; the registration key
+	 * @param ASC Server-side ASC holding the sets
+	 * @param Settings One entry per managed set class; sets without an entry replicate normally
+	 */
+	void RegisterActor(AActor* Actor, UAbilitySystemComponent* ASC, TConstArrayView<FGasXReplicationLODSetting> Settings);
+
+	/** Restore normal replication for every set of Actor. */
+	void UnregisterActor(AActor* Actor);
+
+	/** Viewer/set pairs currently held back by LOD, for stats and tests. */
+	int32 GetNumThrottledPairs() const { return NumThrottledPairs; }
+
+	/** Net condition group Set replicates through, or NAME_None if it is not under LOD. For tests and debugging. */
+	FName GetNetGroup(const UAttributeSet* Set) const;
+
+	/**
+	 * Run one evaluation now instead of waiting for the next tick.
+	 *
+	 * @param Now World time in seconds (UWorld::GetTimeSeconds()), the clock the net driver schedules updates on
+	 */
+	void Evaluate(double Now);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FViewerState
+	{
+		bool bIncluded = false;
+
+		/** Set once the viewer has been in the group; until then it has no copy of the set at all. */
+		bool bHasBeenIncluded = false;
+		double LastFarRefresh = -UE_DOUBLE_BIG_NUMBER;
+
+		/** A far viewer stays in the group until this time, so the refresh survives until the next net update. */
+		double FarRefreshUntil = -UE_DOUBLE_BIG_NUMBER;
+	};
+
+	struct FManagedSet
+	{
+		TWeakObjectPtr<UAttributeSet> Set;
+		FName NetGroup;
+		double FullRateDistanceSquared = 0.0;
+		float FarUpdateInterval = 0.0f;
+		TMap<TWeakObjectPtr<APlayerController>, FViewerState> Viewers;
+	};
+
+	struct FManagedActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		TArray<FManagedSet> Sets;
+	};
+
+	/** Drop group memberships and hand the sets back to normal replication. */
+	void Release(FManagedActor& Managed);
+
+	/** Group name for a newly managed set, reused from released sets where possible. */
+	FName AcquireNetGroup();
+
+	TArray<FManagedActor> ManagedActors;
+
+	/**
+	 * Group names no set is using. WHY: Actors respawn all match long; pooling keeps the set of group names
+	 * bounded by the peak number of managed sets instead of growing with every spawn.
+	 */
+	TArray<FName> FreeNetGroups;
+	int32 NumNetGroups = 0;
+
+	double LastEvaluateTime = -UE_DOUBLE_BIG_NUMBER;
+	int32 NumThrottledPairs = 0;
+};
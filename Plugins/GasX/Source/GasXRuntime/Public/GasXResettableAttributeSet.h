@@ -0,0 +1,43 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "GasXResettableAttributeSet.generated.h"
+
+class UAttributeSet;
+struct FGameplayAttribute;
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UGasXResettableAttributeSet : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Implemented by generated AttributeSets so an existing set can be reused across lives.
+ *
+ * WHY: On respawn or PIE restart the ASC keeps its sets; restoring compiled defaults in place is far cheaper
+ * than destroying and re-creating subobjects, and keeps replicated subobject identity stable for clients.
+ */
+class GASXRUNTIME_API IGasXResettableAttributeSet
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Restore every attribute's base value, array element and flag to its compiled schema default.
+	 * Active effects keep modifying the restored base values; current values follow from them.
+	 */
+	virtual void ResetToDefaults() = 0;
+
+protected:
+	/**
+	 * Put Attribute's base value back to DefaultValue.
+	 *
+	 * WHY: Writing FGameplayAttributeData directly leaves the ASC's aggregator with the old base, which it restores on
+	 * the next modifier evaluation, and fires no change delegates. Only a set no ASC holds yet is written directly.
+	 */
+	static void ResetAttribute(UAttributeSet* Set, const FGameplayAttribute& Attribute, float DefaultValue);
+};
@@ -0,0 +1,75 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "GasXInitAttributeRegistry.h"
+#include "GasXUniversalInitEffect.generated.h"
+
+class UDataTable;
+class UGasXBakedAttributeDefaults;
+class FGasXLevelCurveSamples;
+
+/**
+ * Where the universal init effect reads starting values from. Every source is optional.
+ */
+struct FGasXInitValueSources
+{
+	/** Pre-sampled level curves, sampled at Level */
+	const FGasXLevelCurveSamples* LevelCurves = nullptr;
+	int32 Level = 1;
+
+	/** FGasXAttributeMetadataRow table; rows named after an attribute */
+	const UDataTable* MetadataTable = nullptr;
+
+	/** Cook-baked metadata, looked up under each set's generated <Set>Metadata table name */
+	const UGasXBakedAttributeDefaults* BakedDefaults = nullptr;
+};
+
+/**
+ * Instant init effect covering every generated AttributeSet on an actor with SetByCaller modifiers.
+ *
+ * WHY: One spec and one application per spawn instead of one init effect per set, so the actor produces
+ * a single aggregator/replication event. Magnitudes come from the metadata table when a row matches the
+ * attribute name, otherwise from the generated schema defaults.
+ *
+ * Instances are built at runtime from FGasXInitAttributeRegistry and shared by every actor with the same
+ * combination of sets.
+ */
+UCLASS(Transient)
+class GASXRUNTIME_API UGasXUniversalInitEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGasXUniversalInitEffect();
+
+	/**
+	 * Shared effect for this combination of AttributeSet classes. Built on first request, then reused.
+	 *
+	 * @param SetClasses AttributeSet classes on the actor; classes that did not register are ignored
+	 * @return The effect, or nullptr if none of the classes registered init attributes
+	 */
+	static UGasXUniversalInitEffect* GetForSets(TConstArrayView<const UClass*> SetClasses);
+
+	/**
+	 * Set every SetByCaller magnitude this effect needs on a spec made from it.
+	 * Precedence per attribute: level curve sample, metadata row, baked default, then schema default.
+	 *
+	 * @param Spec Spec created from this effect
+	 * @param Sources Optional value sources; rows are matched by attribute name
+	 */
+	void FillSpec(FGameplayEffectSpec& Spec, const FGasXInitValueSources& Sources) const;
+
+	/** Init attributes covered by this effect, in modifier order. */
+	const TArray<FGasXInitAttribute>& GetInitAttributes() const { return InitAttributes; }
+
+private:
+	void Build(TConstArrayView<const UClass*> SetClasses);
+
+	TArray<FGasXInitAttribute> InitAttributes;
+
+	/** Generated metadata table name (<Set>Metadata) of each init attribute, for baked default lookup. */
+	TArray<FName> MetadataTableNames;
+};
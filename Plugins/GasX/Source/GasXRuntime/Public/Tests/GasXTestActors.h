@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemInterface.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "GasXTestActors.generated.h"
+
+class UAbilitySystemComponent;
+class UGasXAttributeBootstrapComponent;
+
+/**
+ * Replicated actor that hosts its own ASC and exposes it through IAbilitySystemInterface.
+ *
+ * NOTE: Automation fixture only. Replicates through the registered subobject list, which replication LOD requires.
+ */
+UCLASS(NotPlaceable, HideDropdown, Transient)
+class GASXRUNTIME_API AGasXTestASCActor : public AActor, public IAbilitySystemInterface
+{
+	GENERATED_BODY()
+
+public:
+	AGasXTestASCActor();
+
+	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override { return AbilitySystemComponent; }
+
+private:
+	UPROPERTY()
+	UAbilitySystemComponent* AbilitySystemComponent = nullptr;
+};
+
+/**
+ * Test ASC actor with a bootstrap component that adds UPlayerCoreAttributes, recording what it sees when it is told
+ * the attributes are ready. Always relevant, so it replicates to every PIE client.
+ *
+ * NOTE: Automation fixture only.
+ */
+UCLASS(NotPlaceable, HideDropdown, Transient)
+class GASXRUNTIME_API AGasXTestBootstrapActor : public AGasXTestASCActor
+{
+	GENERATED_BODY()
+
+public:
+	AGasXTestBootstrapActor();
+
+	UGasXAttributeBootstrapComponent* GetBootstrap() const { return Bootstrap; }
+
+	/** Bound to the bootstrap's OnAttributesReady at BeginPlay; tests may bind it to other ready delegates too. */
+	UFUNCTION()
+	void HandleAttributesReady();
+
+	/** Times HandleAttributesReady ran. */
+	int32 NumReadyBroadcasts = 0;
+
+	/** UPlayerCoreAttributes Health on this actor's ASC at the last ready broadcast; unset if the set was missing. */
+	TOptional<float> HealthAtReady;
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	UPROPERTY()
+	UGasXAttributeBootstrapComponent* Bootstrap = nullptr;
+};
+
+/**
+ * PlayerState that hosts the player's ASC, as in the usual GAS setup for player-controlled pawns.
+ *
+ * NOTE: Automation fixture only.
+ */
+UCLASS(NotPlaceable, HideDropdown, Transient)
+class GASXRUNTIME_API AGasXTestPlayerState : public APlayerState, public IAbilitySystemInterface
+{
+	GENERATED_BODY()
+
+public:
+	AGasXTestPlayerState();
+
+	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override { return AbilitySystemComponent; }
+
+private:
+	UPROPERTY()
+	UAbilitySystemComponent* AbilitySystemComponent = nullptr;
+};
+
+/**
+ * Pawn with no ASC of its own; it reaches one only through the PlayerState of whoever possesses it.
+ *
+ * NOTE: Automation fixture only. Never auto-possessed, so tests control when possession happens.
+ */
+UCLASS(NotPlaceable, HideDropdown, Transient)
+class GASXRUNTIME_API AGasXTestPawn : public APawn
+{
+	GENERATED_BODY()
+
+public:
+	AGasXTestPawn();
+};
+
+/**
+ * Concrete controller for possessing test pawns without player or AI machinery; tests assign its PlayerState.
+ *
+ * NOTE: Automation fixture only.
+ */
+UCLASS(NotPlaceable, HideDropdown, Transient)
+class GASXRUNTIME_API AGasXTestController : public AController
+{
+	GENERATED_BODY()
+};
@@ -0,0 +1,15 @@
+using UnrealBuildTool;
+
+public class GasXGen : ModuleRules
+{
+    public GasXGen(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PublicIncludePathModuleNames.Add("Launch");
+
+        PrivateDependencyModuleNames.AddRange(new[]
+        {
+            "Core", "Projects",
+            "GasXCodeGen"
+        });
+    }
+}
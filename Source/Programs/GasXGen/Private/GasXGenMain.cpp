@@ -0,0 +1,161 @@
+// Copyright Epic Games, Inc.
+
+#include "RequiredProgramMainCPPInclude.h"
+#include "GasXAttributeSetEmitter.h"
+#include "GasXGenerateExitCode.h"
+#include "GasXSchemaGraph.h"
+#include "GasXSchemaParser.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+/**
+ * Standalone GasX code generator.
+ *
+ * WHY: The GasXGenerate commandlet boots the whole editor before it can parse a single schema. This program links
+ * only Core and GasXCodeGen, so CI and pre-build steps regenerate or verify C++ in well under a second. It never
+ * touches assets; metadata DataTables and level curve tables still come from the commandlet or the editor.
+ *
+ * Usage:
+ *   GasXGen -Schemas=<glob> [-ProjectDir=<dir>] [-PluginDir=<dir>] [-Verify] [-NoSchemaCache]
+ *
+ * Relative globs resolve against -ProjectDir (default: the working directory); -PluginDir defaults to
+ * <ProjectDir>/Plugins/GasX. Parse results are cached in <ProjectDir>/Saved/GasX/SchemaCache, shared with the
+ * editor. Exit codes match the commandlet (EGasXGenerateExitCode).
+ */
+
+DEFINE_LOG_CATEGORY_STATIC(LogGasXGen, Log, All);
+
+IMPLEMENT_APPLICATION(GasXGen, "GasXGen");
+
+namespace GasXGen
+{
+	int32 Run(const TCHAR* Params)
+	{
+		FString Glob;
+		if (!FParse::Value(Params, TEXT("Schemas="), Glob))
+		{
+			UE_LOG(LogGasXGen, Error, TEXT("Usage: GasXGen -Schemas=<glob> [-ProjectDir=<dir>] [-PluginDir=<dir>] [-Verify] [-NoSchemaCache]"));
+			return EGasXGenerateExitCode::InvalidArguments;
+		}
+
+		const bool bVerify = FParse::Param(Params, TEXT("Verify"));
+
+		FString ProjectDir;
+		if (!FParse::Value(Params, TEXT("ProjectDir="), ProjectDir))
+		{
+			ProjectDir = FPlatformProcess::GetCurrentWorkingDirectory();
+		}
+		ProjectDir = FPaths::ConvertRelativePathToFull(ProjectDir);
+
+		FString PluginDir;
+		if (!FParse::Value(Params, TEXT("PluginDir="), PluginDir))
+		{
+			PluginDir = ProjectDir / TEXT("Plugins") / TEXT("GasX");
+		}
+		PluginDir = FPaths::ConvertRelativePathToFull(ProjectDir, PluginDir);
+
+		// WHY: FPaths::ProjectSavedDir() is this program's own Saved directory under the engine, not the project's
+		const FString SchemaCacheDirectory = FParse::Param(Params, TEXT("NoSchemaCache")) ? FString() : FGasXSchemaParser::GetCacheDirectory(ProjectDir / TEXT("Saved"));
+
+		const TArray<FString> SchemaFiles = FGasXSchemaParser::FindSchemaFiles(Glob, ProjectDir);
+		if (SchemaFiles.Num() == 0)
+		{
+			UE_LOG(LogGasXGen, Error, TEXT("No schema files matched: %s"), *Glob);
+			return EGasXGenerateExitCode::InvalidArguments;
+		}
+
+		UE_LOG(LogGasXGen, Display, TEXT("%s %d schema(s) matching %s"), bVerify ? TEXT("Verifying") : TEXT("Generating"), SchemaFiles.Num(), *Glob);
+
+		const double RunStartTime = FPlatformTime::Seconds();
+
+		FGasXSchemaGraph Graph;
+		Graph.AddSchemas(SchemaFiles, SchemaCacheDirectory);
+
+		const FGasXAttributeSetEmitter Emitter;
+		int32 NumFailed = 0;
+		int32 NumOutOfDate = 0;
+
+		for (const FString& SchemaPath : SchemaFiles)
+		{
+			for (const FGasXSchemaDiagnostic& Diagnostic : Graph.GetDiagnostics(SchemaPath))
+			{
+				if (Diagnostic.bIsError)
+				{
+					UE_LOG(LogGasXGen, Error, TEXT("%s"), *Diagnostic.ToString());
+				}
+				else
+				{
+					UE_LOG(LogGasXGen, Warning, TEXT("%s"), *Diagnostic.ToString());
+				}
+			}
+
+			const FGasXAttributeSetSchema* Schema = Graph.GetResolvedSchema(SchemaPath);
+			if (!Schema)
+			{
+				++NumFailed;
+				continue;
+			}
+
+			if (Schema->bIsFragment)
+			{
+				continue;
+			}
+
+			FString HeaderPath, SourcePath;
+			FGasXAttributeSetEmitter::ResolveOutputPaths(*Schema, PluginDir, HeaderPath, SourcePath);
+
+			FString Error;
+			if (bVerify)
+			{
+				TArray<FString> OutOfDateFiles;
+				if (!Emitter.CollectOutOfDateFiles(*Schema, HeaderPath, SourcePath, OutOfDateFiles, Error))
+				{
+					UE_LOG(LogGasXGen, Error, TEXT("%s: %s"), *SchemaPath, *Error);
+					++NumFailed;
+					continue;
+				}
+
+				for (const FString& OutOfDateFile : OutOfDateFiles)
+				{
+					UE_LOG(LogGasXGen, Warning, TEXT("Out of date: %s (schema %s)"), *OutOfDateFile, *SchemaPath);
+				}
+				NumOutOfDate += OutOfDateFiles.Num();
+			}
+			else if (!Emitter.GenerateFiles(*Schema, HeaderPath, SourcePath, Error))
+			{
+				UE_LOG(LogGasXGen, Error, TEXT("%s: %s"), *SchemaPath, *Error);
+				++NumFailed;
+			}
+		}
+
+		UE_LOG(LogGasXGen, Display, TEXT("Processed %d schema(s) in %.2f ms: %d failed, %d out-of-date file(s)"),
+			SchemaFiles.Num(), (FPlatformTime::Seconds() - RunStartTime) * 1000.0, NumFailed, NumOutOfDate);
+
+		if (NumFailed > 0)
+		{
+			return EGasXGenerateExitCode::GenerationFailed;
+		}
+
+		return NumOutOfDate > 0 ? EGasXGenerateExitCode::OutOfDate : EGasXGenerateExitCode::Success;
+	}
+}
+
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+{
+	const int32 PreInitResult = GEngineLoop.PreInit(ArgC, ArgV);
+	if (PreInitResult != 0)
+	{
+		return EGasXGenerateExitCode::InvalidArguments;
+	}
+
+	UE_LOG(LogGasXGen, Display, TEXT("Startup: %.2f ms"), (FPlatformTime::Seconds() - GStartTime) * 1000.0);
+
+	const int32 ExitCode = GasXGen::Run(FCommandLine::Get());
+
+	FEngineLoop::AppPreExit();
+	FEngineLoop::AppExit();
+	return ExitCode;
+}